@@ -0,0 +1,13 @@
+fn main() {
+    // whisper-rs-sys compiles and links whisper.cpp itself; we only need the
+    // Apple frameworks that the Metal backend pulls in when building on macOS.
+    #[cfg(target_os = "macos")]
+    {
+        println!("cargo:rustc-link-lib=framework=Metal");
+        println!("cargo:rustc-link-lib=framework=MetalKit");
+        println!("cargo:rustc-link-lib=framework=Foundation");
+        println!("cargo:rustc-link-lib=framework=Accelerate");
+    }
+
+    napi_build::setup();
+}
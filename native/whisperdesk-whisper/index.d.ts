@@ -0,0 +1,88 @@
+/* tslint:disable */
+/* eslint-disable */
+
+/* auto-generated by NAPI-RS */
+
+export interface TranscriptSegment {
+  /** Segment start time in seconds */
+  start: number
+  /** Segment end time in seconds */
+  end: number
+  text: string
+}
+export interface TranscribeOptions {
+  /** BCP-47 language code, or omitted for auto-detection */
+  language?: string
+  translate?: boolean
+  threads?: number
+  /** Initial decoding temperature (0 = greedy) */
+  temperature?: number
+  /**
+   * Emit one segment per word with token-aligned timestamps
+   * (whisper.cpp token_timestamps + split_on_word + max_len 1)
+   */
+  wordTimestamps?: boolean
+}
+/**
+ * Decode an audio (or video-with-audio) file to 16 kHz mono f32 PCM entirely
+ * in-process - no ffmpeg spawn, no converted WAV on disk. Runs on a blocking
+ * worker thread; the returned buffer feeds straight into transcribe().
+ */
+export function decodeAudio(path: string): Promise<Float32Array>
+export interface SegmentSpan {
+  /** Transcript segment start time in seconds */
+  start: number
+  /** Transcript segment end time in seconds */
+  end: number
+}
+export interface SpeakerTurn {
+  start: number
+  end: number
+  speakerId: number
+  confidence?: number
+}
+export interface SpeakerAssignment {
+  speakerId: number
+  confidence: number
+  /** Combined match score (0 for fallback assignments) */
+  score: number
+  /** Overlap with the winning turn in seconds */
+  overlap: number
+  /** "enhanced_onnx" | "enhanced_fallback" | "smoothed_transition" */
+  method: string
+}
+/**
+ * Assign a speaker to each transcript segment from the diarization turns in
+ * one sweep over the two sorted lists, replacing the O(segments x turns)
+ * scan the JS merge did on the Electron main thread. Scoring, fallback and
+ * smoothing semantics match mergeEnhancedDiarizationWithTranscription(); the
+ * caller applies the returned assignments to its own segment objects so no
+ * text crosses the N-API boundary.
+ */
+export function mergeSpeakerSegments(segments: Array<SegmentSpan>, turns: Array<SpeakerTurn>, totalDuration?: number | undefined | null, totalSpeakers?: number | undefined | null): Array<SpeakerAssignment>
+export interface EmbeddingMatch {
+  /** Row index into the packed matrix */
+  index: number
+  /** Cosine similarity (rows and query are L2-normalized, so this is a dot product) */
+  score: number
+}
+/**
+ * Cosine-similarity search over a packed row-major matrix of L2-normalized
+ * speaker embeddings. The whole index crosses the N-API boundary as one
+ * Float32Array (zero-copy) and the dot products autovectorize, so matching
+ * a query against thousands of stored speakers stays well under a
+ * millisecond.
+ */
+export function embeddingSearch(query: Float32Array, vectors: Float32Array, dim: number, topK: number): Array<EmbeddingMatch>
+export function getVersion(): string
+export class WhisperEngine {
+  /** Load a GGML model and keep the whisper_context resident. */
+  constructor(modelPath: string)
+  get modelPath(): string
+  /**
+   * Transcribe 16 kHz mono f32 PCM. Runs on a blocking worker thread so the
+   * Node event loop stays responsive; each call gets its own whisper_state,
+   * so concurrent calls against one loaded model are safe.
+   */
+  transcribe(pcm: Float32Array, options?: TranscribeOptions | undefined | null): Promise<Array<TranscriptSegment>>
+}
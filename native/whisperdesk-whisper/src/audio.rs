@@ -0,0 +1,167 @@
+// In-process audio decode + resample for WhisperDesk
+//
+// Replaces the ffmpeg spawn + converted_<id>.wav temp file: symphonia demuxes
+// and decodes the container directly, frames are downmixed to mono as they
+// arrive, and rubato's SIMD sinc resampler brings the stream to the 16 kHz
+// whisper expects. Nothing is written to disk and the decoded PCM goes
+// straight into the engine.
+
+use napi::bindgen_prelude::*;
+use rubato::{
+    Resampler, SincFixedIn, SincInterpolationParameters, SincInterpolationType, WindowFunction,
+};
+use symphonia::core::audio::SampleBuffer;
+use symphonia::core::codecs::{DecoderOptions, CODEC_TYPE_NULL};
+use symphonia::core::errors::Error as SymphoniaError;
+use symphonia::core::formats::FormatOptions;
+use symphonia::core::io::MediaSourceStream;
+use symphonia::core::meta::MetadataOptions;
+use symphonia::core::probe::Hint;
+
+/// Whisper consumes 16 kHz mono PCM.
+const TARGET_SAMPLE_RATE: u32 = 16_000;
+
+/// Input frames handed to the resampler per call.
+const RESAMPLER_CHUNK: usize = 4096;
+
+/// Decode any container symphonia supports (wav/mp3/flac/ogg/m4a/mp4/...) to
+/// 16 kHz mono f32 PCM. Video streams are ignored; the default audio track is
+/// used. Errors mirror the ffmpeg path: a file with no decodable audio track
+/// is reported as containing no audio streams.
+pub fn decode_to_pcm_16k(path: &str) -> Result<Vec<f32>> {
+    let file = std::fs::File::open(path)
+        .map_err(|e| Error::from_reason(format!("Failed to open {}: {}", path, e)))?;
+    let mss = MediaSourceStream::new(Box::new(file), Default::default());
+
+    let mut hint = Hint::new();
+    if let Some(ext) = std::path::Path::new(path)
+        .extension()
+        .and_then(|ext| ext.to_str())
+    {
+        hint.with_extension(ext);
+    }
+
+    let probed = symphonia::default::get_probe()
+        .format(
+            &hint,
+            mss,
+            &FormatOptions::default(),
+            &MetadataOptions::default(),
+        )
+        .map_err(|e| Error::from_reason(format!("Unrecognized audio format: {}", e)))?;
+
+    let mut format = probed.format;
+
+    let track = format
+        .tracks()
+        .iter()
+        .find(|t| t.codec_params.codec != CODEC_TYPE_NULL)
+        .ok_or_else(|| {
+            Error::from_reason(format!(
+                "File {} contains no audio streams",
+                path
+            ))
+        })?;
+    let track_id = track.id;
+
+    let mut decoder = symphonia::default::get_codecs()
+        .make(&track.codec_params, &DecoderOptions::default())
+        .map_err(|e| Error::from_reason(format!("Unsupported audio codec: {}", e)))?;
+
+    let mut source_rate = track.codec_params.sample_rate.unwrap_or(0);
+    let mut mono: Vec<f32> = Vec::new();
+    let mut sample_buf: Option<SampleBuffer<f32>> = None;
+
+    loop {
+        let packet = match format.next_packet() {
+            Ok(packet) => packet,
+            // End of stream surfaces as an IO error in symphonia
+            Err(SymphoniaError::IoError(_)) | Err(SymphoniaError::ResetRequired) => break,
+            Err(e) => return Err(Error::from_reason(format!("Demux error: {}", e))),
+        };
+
+        if packet.track_id() != track_id {
+            continue;
+        }
+
+        match decoder.decode(&packet) {
+            Ok(decoded) => {
+                let spec = *decoded.spec();
+                source_rate = spec.rate;
+                let channels = spec.channels.count().max(1);
+
+                let buf = sample_buf.get_or_insert_with(|| {
+                    SampleBuffer::<f32>::new(decoded.capacity() as u64, spec)
+                });
+                buf.copy_interleaved_ref(decoded);
+
+                // Downmix interleaved frames to mono by averaging channels
+                for frame in buf.samples().chunks_exact(channels) {
+                    mono.push(frame.iter().sum::<f32>() / channels as f32);
+                }
+            }
+            // A corrupt packet is recoverable - skip it like ffmpeg does
+            Err(SymphoniaError::DecodeError(_)) => continue,
+            Err(e) => return Err(Error::from_reason(format!("Decode error: {}", e))),
+        }
+    }
+
+    if mono.is_empty() {
+        return Err(Error::from_reason(format!(
+            "File {} contains no audio streams",
+            path
+        )));
+    }
+    if source_rate == 0 {
+        return Err(Error::from_reason(
+            "Audio track does not declare a sample rate".to_string(),
+        ));
+    }
+
+    resample_to_16k(mono, source_rate)
+}
+
+/// Resample mono PCM to 16 kHz with a windowed-sinc resampler (vectorized by
+/// rubato on x86_64 and aarch64). Pass-through when the source already matches.
+fn resample_to_16k(samples: Vec<f32>, source_rate: u32) -> Result<Vec<f32>> {
+    if source_rate == TARGET_SAMPLE_RATE {
+        return Ok(samples);
+    }
+
+    let params = SincInterpolationParameters {
+        sinc_len: 128,
+        f_cutoff: 0.95,
+        interpolation: SincInterpolationType::Linear,
+        oversampling_factor: 256,
+        window: WindowFunction::BlackmanHarris2,
+    };
+
+    let mut resampler = SincFixedIn::<f32>::new(
+        TARGET_SAMPLE_RATE as f64 / source_rate as f64,
+        1.0,
+        params,
+        RESAMPLER_CHUNK,
+        1,
+    )
+    .map_err(|e| Error::from_reason(format!("Failed to create resampler: {}", e)))?;
+
+    let estimated = (samples.len() as u64 * TARGET_SAMPLE_RATE as u64 / source_rate as u64) as usize;
+    let mut output: Vec<f32> = Vec::with_capacity(estimated + RESAMPLER_CHUNK);
+
+    let mut chunks = samples.chunks_exact(RESAMPLER_CHUNK);
+    for chunk in &mut chunks {
+        let resampled = resampler
+            .process(&[chunk], None)
+            .map_err(|e| Error::from_reason(format!("Resampling failed: {}", e)))?;
+        output.extend_from_slice(&resampled[0]);
+    }
+
+    // Flush the tail (and the resampler's internal delay line)
+    let remainder = chunks.remainder();
+    let resampled = resampler
+        .process_partial(if remainder.is_empty() { None } else { Some(&[remainder]) }, None)
+        .map_err(|e| Error::from_reason(format!("Resampling failed: {}", e)))?;
+    output.extend_from_slice(&resampled[0]);
+
+    Ok(output)
+}
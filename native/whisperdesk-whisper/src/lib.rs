@@ -0,0 +1,234 @@
+// In-process whisper.cpp binding for WhisperDesk
+//
+// Replaces the child_process + VTT round-trip for the hot path: callers hand
+// us 16 kHz mono PCM as a Float32Array (zero-copy into N-API) and get the
+// decoded segments back as structured objects. The context stays loaded for
+// the lifetime of the WhisperEngine instance, so repeat jobs skip model load.
+
+use std::sync::Arc;
+
+use napi::bindgen_prelude::*;
+use napi_derive::napi;
+use whisper_rs::{FullParams, SamplingStrategy, WhisperContext, WhisperContextParameters};
+
+mod audio;
+mod merge;
+
+#[napi(object)]
+#[derive(Clone)]
+pub struct TranscriptSegment {
+    /// Segment start time in seconds
+    pub start: f64,
+    /// Segment end time in seconds
+    pub end: f64,
+    pub text: String,
+}
+
+#[napi(object)]
+pub struct TranscribeOptions {
+    /// BCP-47 language code, or omitted for auto-detection
+    pub language: Option<String>,
+    pub translate: Option<bool>,
+    pub threads: Option<u32>,
+    /// Initial decoding temperature (0 = greedy)
+    pub temperature: Option<f64>,
+    /// Emit one segment per word with token-aligned timestamps
+    /// (whisper.cpp token_timestamps + split_on_word + max_len 1)
+    pub word_timestamps: Option<bool>,
+}
+
+#[napi]
+pub struct WhisperEngine {
+    ctx: Arc<WhisperContext>,
+    model_path: String,
+}
+
+#[napi]
+impl WhisperEngine {
+    /// Load a GGML model and keep the whisper_context resident.
+    #[napi(constructor)]
+    pub fn new(model_path: String) -> Result<Self> {
+        let ctx = WhisperContext::new_with_params(&model_path, WhisperContextParameters::default())
+            .map_err(|e| Error::from_reason(format!("Failed to load model {}: {:?}", model_path, e)))?;
+
+        Ok(Self {
+            ctx: Arc::new(ctx),
+            model_path,
+        })
+    }
+
+    #[napi(getter)]
+    pub fn model_path(&self) -> String {
+        self.model_path.clone()
+    }
+
+    /// Transcribe 16 kHz mono f32 PCM. Runs on a blocking worker thread so the
+    /// Node event loop stays responsive; each call gets its own whisper_state,
+    /// so concurrent calls against one loaded model are safe.
+    #[napi]
+    pub async fn transcribe(
+        &self,
+        pcm: Float32Array,
+        options: Option<TranscribeOptions>,
+    ) -> Result<Vec<TranscriptSegment>> {
+        let ctx = Arc::clone(&self.ctx);
+        let samples: Vec<f32> = pcm.to_vec();
+        let options = options.unwrap_or(TranscribeOptions {
+            language: None,
+            translate: None,
+            threads: None,
+            temperature: None,
+            word_timestamps: None,
+        });
+
+        tokio::task::spawn_blocking(move || run_transcription(&ctx, &samples, &options))
+            .await
+            .map_err(|e| Error::from_reason(format!("Transcription task panicked: {}", e)))?
+    }
+}
+
+fn run_transcription(
+    ctx: &WhisperContext,
+    samples: &[f32],
+    options: &TranscribeOptions,
+) -> Result<Vec<TranscriptSegment>> {
+    let mut state = ctx
+        .create_state()
+        .map_err(|e| Error::from_reason(format!("Failed to create whisper state: {:?}", e)))?;
+
+    let mut params = FullParams::new(SamplingStrategy::Greedy { best_of: 1 });
+
+    if let Some(language) = options.language.as_deref() {
+        if language != "auto" {
+            params.set_language(Some(language));
+        }
+    }
+    if options.translate.unwrap_or(false) {
+        params.set_translate(true);
+    }
+    if let Some(threads) = options.threads {
+        params.set_n_threads(threads as i32);
+    }
+    if let Some(temperature) = options.temperature {
+        params.set_temperature(temperature as f32);
+    }
+    if options.word_timestamps.unwrap_or(false) {
+        params.set_token_timestamps(true);
+        params.set_split_on_word(true);
+        params.set_max_len(1);
+    }
+
+    params.set_print_progress(false);
+    params.set_print_realtime(false);
+    params.set_print_special(false);
+
+    state
+        .full(params, samples)
+        .map_err(|e| Error::from_reason(format!("Transcription failed: {:?}", e)))?;
+
+    let num_segments = state
+        .full_n_segments()
+        .map_err(|e| Error::from_reason(format!("Failed to read segment count: {:?}", e)))?;
+
+    let mut segments = Vec::with_capacity(num_segments as usize);
+    for i in 0..num_segments {
+        let text = state
+            .full_get_segment_text(i)
+            .map_err(|e| Error::from_reason(format!("Failed to read segment {}: {:?}", i, e)))?;
+        // whisper.cpp timestamps are in centiseconds
+        let start = state.full_get_segment_t0(i).unwrap_or(0) as f64 / 100.0;
+        let end = state.full_get_segment_t1(i).unwrap_or(0) as f64 / 100.0;
+
+        let trimmed = text.trim();
+        if !trimmed.is_empty() {
+            segments.push(TranscriptSegment {
+                start,
+                end,
+                text: trimmed.to_string(),
+            });
+        }
+    }
+
+    Ok(segments)
+}
+
+/// Decode an audio (or video-with-audio) file to 16 kHz mono f32 PCM entirely
+/// in-process - no ffmpeg spawn, no converted WAV on disk. Runs on a blocking
+/// worker thread; the returned buffer feeds straight into transcribe().
+#[napi]
+pub async fn decode_audio(path: String) -> Result<Float32Array> {
+    let samples = tokio::task::spawn_blocking(move || audio::decode_to_pcm_16k(&path))
+        .await
+        .map_err(|e| Error::from_reason(format!("Decode task panicked: {}", e)))??;
+
+    Ok(Float32Array::new(samples))
+}
+
+/// Assign a speaker to each transcript segment from the diarization turns in
+/// one sweep over the two sorted lists, replacing the O(segments x turns)
+/// scan the JS merge did on the Electron main thread. Scoring, fallback and
+/// smoothing semantics match mergeEnhancedDiarizationWithTranscription(); the
+/// caller applies the returned assignments to its own segment objects so no
+/// text crosses the N-API boundary.
+#[napi]
+pub fn merge_speaker_segments(
+    segments: Vec<merge::SegmentSpan>,
+    turns: Vec<merge::SpeakerTurn>,
+    total_duration: Option<f64>,
+    total_speakers: Option<u32>,
+) -> Vec<merge::SpeakerAssignment> {
+    let mut turns = turns;
+    merge::assign_speakers(&segments, &mut turns, total_duration, total_speakers)
+}
+
+#[napi(object)]
+pub struct EmbeddingMatch {
+    /// Row index into the packed matrix
+    pub index: u32,
+    /// Cosine similarity (rows and query are L2-normalized, so this is a dot product)
+    pub score: f64,
+}
+
+/// Cosine-similarity search over a packed row-major matrix of L2-normalized
+/// speaker embeddings. The whole index crosses the N-API boundary as one
+/// Float32Array (zero-copy) and the dot products autovectorize, so matching
+/// a query against thousands of stored speakers stays well under a
+/// millisecond.
+#[napi]
+pub fn embedding_search(
+    query: Float32Array,
+    vectors: Float32Array,
+    dim: u32,
+    top_k: u32,
+) -> Result<Vec<EmbeddingMatch>> {
+    let dim = dim as usize;
+    if dim == 0 || query.len() != dim || vectors.len() % dim != 0 {
+        return Err(Error::from_reason(
+            "embedding_search: query/matrix dimensions do not match".to_string(),
+        ));
+    }
+
+    let rows = vectors.len() / dim;
+    let mut matches: Vec<EmbeddingMatch> = Vec::with_capacity(rows);
+    for row in 0..rows {
+        let base = row * dim;
+        let dot: f32 = vectors[base..base + dim]
+            .iter()
+            .zip(query.iter())
+            .map(|(a, b)| a * b)
+            .sum();
+        matches.push(EmbeddingMatch {
+            index: row as u32,
+            score: dot as f64,
+        });
+    }
+
+    matches.sort_by(|a, b| b.score.partial_cmp(&a.score).unwrap_or(std::cmp::Ordering::Equal));
+    matches.truncate(top_k.max(1) as usize);
+    Ok(matches)
+}
+
+#[napi]
+pub fn get_version() -> String {
+    env!("CARGO_PKG_VERSION").to_string()
+}
@@ -0,0 +1,153 @@
+// Sweep-line speaker assignment for WhisperDesk
+//
+// The JS merge (mergeEnhancedDiarizationWithTranscription) scored every
+// transcript segment against every diarization turn - O(segments * turns) on
+// the Electron main thread, which visibly stalls the UI on multi-hour
+// recordings. Both lists are sorted by time, so a two-pointer sweep only
+// scores the turns that can actually overlap each segment. The scoring
+// itself (overlap ratio + temporal proximity + duration similarity), the
+// temporal-distribution fallback for unmatched segments, and the
+// short-segment smoothing pass all mirror the JS implementation so the two
+// paths produce the same labels.
+
+use napi_derive::napi;
+
+/// Minimum combined score for a turn to claim a segment.
+const MATCH_THRESHOLD: f64 = 0.1;
+
+/// Segments shorter than this are folded into a matching neighbor's speaker.
+const MIN_SEGMENT_DURATION: f64 = 2.0;
+
+#[napi(object)]
+pub struct SegmentSpan {
+    /// Transcript segment start in seconds
+    pub start: f64,
+    /// Transcript segment end in seconds
+    pub end: f64,
+}
+
+#[napi(object)]
+pub struct SpeakerTurn {
+    pub start: f64,
+    pub end: f64,
+    pub speaker_id: i32,
+    pub confidence: Option<f64>,
+}
+
+#[napi(object)]
+#[derive(Clone)]
+pub struct SpeakerAssignment {
+    pub speaker_id: i32,
+    pub confidence: f64,
+    /// Combined match score (0 for fallback assignments)
+    pub score: f64,
+    /// Overlap with the winning turn in seconds
+    pub overlap: f64,
+    /// "enhanced_onnx" | "enhanced_fallback" | "smoothed_transition"
+    pub method: String,
+}
+
+pub fn assign_speakers(
+    segments: &[SegmentSpan],
+    turns: &mut Vec<SpeakerTurn>,
+    total_duration: Option<f64>,
+    total_speakers: Option<u32>,
+) -> Vec<SpeakerAssignment> {
+    turns.sort_by(|a, b| a.start.partial_cmp(&b.start).unwrap_or(std::cmp::Ordering::Equal));
+
+    let fallback_duration = total_duration
+        .filter(|d| *d > 0.0)
+        .unwrap_or_else(|| turns.iter().map(|t| t.end).fold(1.0, f64::max));
+    let fallback_speakers = total_speakers.unwrap_or(2).max(1) as f64;
+
+    let mut assignments = Vec::with_capacity(segments.len());
+    let mut base = 0usize;
+
+    for segment in segments {
+        let seg_start = segment.start;
+        let seg_end = segment.end;
+        let seg_mid = (seg_start + seg_end) / 2.0;
+        let seg_duration = seg_end - seg_start;
+
+        // Segments are sorted by start, so turns ending before this segment
+        // can never overlap a later one either
+        while base < turns.len() && turns[base].end < seg_start {
+            base += 1;
+        }
+
+        let mut best: Option<(&SpeakerTurn, f64, f64)> = None;
+        let mut i = base;
+        while i < turns.len() && turns[i].start < seg_end {
+            let turn = &turns[i];
+            let overlap = (seg_end.min(turn.end) - seg_start.max(turn.start)).max(0.0);
+            if overlap > 0.0 {
+                let turn_duration = turn.end - turn.start;
+                let longest = seg_duration.max(turn_duration).max(f64::EPSILON);
+                let overlap_ratio = overlap / longest;
+                let proximity =
+                    1.0 - (seg_mid - (turn.start + turn.end) / 2.0).abs() / seg_duration.max(1.0);
+                let duration_similarity = 1.0 - (seg_duration - turn_duration).abs() / longest;
+                let score =
+                    overlap_ratio * 0.6 + proximity * 0.3 + duration_similarity * 0.1;
+
+                if best.map_or(true, |(_, best_score, _)| score > best_score) {
+                    best = Some((turn, score, overlap));
+                }
+            }
+            i += 1;
+        }
+
+        assignments.push(match best {
+            Some((turn, score, overlap)) if score > MATCH_THRESHOLD => SpeakerAssignment {
+                speaker_id: turn.speaker_id,
+                confidence: turn.confidence.unwrap_or(0.9),
+                score,
+                overlap,
+                method: "enhanced_onnx".to_string(),
+            },
+            _ => {
+                // Distribute unmatched segments across speakers by position,
+                // mirroring the JS fallback
+                let position_ratio = (seg_mid / fallback_duration).clamp(0.0, 1.0);
+                let speaker =
+                    ((position_ratio * fallback_speakers) as i32 + 1).min(fallback_speakers as i32);
+                SpeakerAssignment {
+                    speaker_id: speaker,
+                    confidence: 0.6,
+                    score: 0.0,
+                    overlap: 0.0,
+                    method: "enhanced_fallback".to_string(),
+                }
+            }
+        });
+    }
+
+    smooth_transitions(segments, &mut assignments);
+    assignments
+}
+
+/// Fold segments shorter than MIN_SEGMENT_DURATION into a neighbor that
+/// shares their speaker, reducing rapid speaker flicker.
+fn smooth_transitions(segments: &[SegmentSpan], assignments: &mut [SpeakerAssignment]) {
+    if assignments.len() <= 2 {
+        return;
+    }
+
+    for i in 1..assignments.len() - 1 {
+        let duration = segments[i].end - segments[i].start;
+        if duration >= MIN_SEGMENT_DURATION {
+            continue;
+        }
+
+        let prev = assignments[i - 1].clone();
+        let next = assignments[i + 1].clone();
+        let current = &mut assignments[i];
+
+        if prev.speaker_id == current.speaker_id || next.speaker_id == current.speaker_id {
+            let neighbor = if prev.speaker_id == current.speaker_id { prev } else { next };
+            current.speaker_id = neighbor.speaker_id;
+            current.confidence = current.confidence.max(neighbor.confidence);
+            current.method = "smoothed_transition".to_string();
+        }
+    }
+}
@@ -37,13 +37,35 @@ set(WHISPER_BUILD_SERVER OFF CACHE BOOL "Build whisper server" FORCE)
 
 # Disable optional dependencies that might introduce dynamic linking
 set(WHISPER_SDL2 OFF CACHE BOOL "Use SDL2 for audio" FORCE)
-set(WHISPER_COREML OFF CACHE BOOL "Enable Core ML" FORCE)
 set(WHISPER_OPENVINO OFF CACHE BOOL "Enable OpenVINO" FORCE)
 
-# CPU-only build for maximum compatibility
+# CoreML encoder on macOS: runs the encoder on the Apple Neural Engine
+# several times faster and at lower power than the CPU/GPU path - it matters
+# for transcription on battery. ALLOW_FALLBACK keeps whisper-cli working for
+# models that have no ggml-<model>-encoder.mlmodelc bundle next to them; the
+# model manager downloads those bundles per installed model when it can.
+if(APPLE)
+    set(WHISPER_COREML ON CACHE BOOL "Enable Core ML" FORCE)
+    set(WHISPER_COREML_ALLOW_FALLBACK ON CACHE BOOL "Fall back when no CoreML model is present" FORCE)
+else()
+    set(WHISPER_COREML OFF CACHE BOOL "Enable Core ML" FORCE)
+endif()
+
+# CPU-only on Windows/Linux for maximum compatibility
 set(WHISPER_CUDA OFF CACHE BOOL "Enable CUDA" FORCE)
 set(WHISPER_VULKAN OFF CACHE BOOL "Enable Vulkan" FORCE)
-set(WHISPER_METAL OFF CACHE BOOL "Enable Metal" FORCE)
+
+# Metal GPU offload on macOS - whisper falls back to CPU at runtime when the
+# GPU is unavailable, so enabling it does not cost compatibility on Macs.
+# The shader library is embedded into the binary (GGML_METAL_EMBED_LIBRARY)
+# so no separate ggml-metal.metal file has to ship next to whisper-cli.
+if(APPLE)
+    set(WHISPER_METAL ON CACHE BOOL "Enable Metal" FORCE)
+    set(GGML_METAL ON CACHE BOOL "Enable Metal" FORCE)
+    set(GGML_METAL_EMBED_LIBRARY ON CACHE BOOL "Embed Metal shader library" FORCE)
+else()
+    set(WHISPER_METAL OFF CACHE BOOL "Enable Metal" FORCE)
+endif()
 
 # Function to apply static linking to all targets
 function(apply_static_linking_to_targets)
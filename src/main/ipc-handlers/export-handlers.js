@@ -54,6 +54,19 @@ class ExportHandlers {
       }
     });
 
+    ipcMain.handle('export:toFile', async (event, data, format, filePath, options) => {
+      try {
+        const service = this.getExportService();
+        if (service?.exportToFile) {
+          return await service.exportToFile(data, format, filePath, options || {});
+        }
+        return { success: false, error: 'Export service not available' };
+      } catch (error) {
+        console.error('❌ Failed to export to file:', error);
+        return { success: false, error: error.message };
+      }
+    });
+
     ipcMain.handle('export:saveToFile', async (event, data, filePath) => {
       try {
         const service = this.getExportService();
@@ -8,20 +8,77 @@ class ModelHandlers {
 
   setup() {
     console.log('🔧 Setting up model IPC handlers...');
-    
+
     this.setupModelManagement();
     this.setupDownloadHandlers();
     this.setupModelInfo();
-    
+    this.setupBenchmark();
+
     console.log('✅ Model IPC handlers set up');
   }
 
+  // NEW: Hardware benchmarking (whisper-bench) for model selection guidance
+  setupBenchmark() {
+    ipcMain.handle('model:runBenchmark', async () => {
+      try {
+        console.log('📊 [IPC] Benchmark run requested');
+
+        const benchmarkService = this.getBenchmarkService();
+        if (!benchmarkService) {
+          throw new Error('Benchmark service not available');
+        }
+
+        return await benchmarkService.runFullBenchmark();
+      } catch (error) {
+        console.error('❌ [IPC] Benchmark failed:', error.message);
+        throw error; // Re-throw so renderer gets the specific error
+      }
+    });
+
+    ipcMain.handle('model:getHardwareProfile', () => {
+      try {
+        const benchmarkService = this.getBenchmarkService();
+        if (benchmarkService?.getHardwareProfile) {
+          return benchmarkService.getHardwareProfile();
+        }
+        return null;
+      } catch (error) {
+        console.error('❌ [IPC] Failed to get hardware profile:', error);
+        return null;
+      }
+    });
+
+    ipcMain.handle('model:isBenchmarkAvailable', async () => {
+      try {
+        const benchmarkService = this.getBenchmarkService();
+        if (benchmarkService?.isAvailable) {
+          return await benchmarkService.isAvailable();
+        }
+        return false;
+      } catch (error) {
+        console.error('❌ [IPC] Failed to check benchmark availability:', error);
+        return false;
+      }
+    });
+  }
+
   setupModelManagement() {
     ipcMain.handle('model:getAvailable', async () => {
       try {
         const modelManager = this.getModelManager();
         if (modelManager?.getAvailableModels) {
-          return await modelManager.getAvailableModels();
+          const models = await modelManager.getAvailableModels();
+
+          // NEW: Attach expected transcription speed from the stored hardware
+          // profile so the Models tab can show what this machine can handle
+          const benchmarkService = this.getBenchmarkService();
+          if (benchmarkService) {
+            return models.map(model => ({
+              ...model,
+              expectedSpeed: benchmarkService.getExpectedSpeed(model.id)
+            }));
+          }
+          return models;
         }
         return [];
       } catch (error) {
@@ -114,6 +171,38 @@ class ModelHandlers {
       }
     });
 
+    // NEW: Local quantization via the bundled whisper.cpp quantize tool
+    ipcMain.handle('model:quantize', async (event, modelId, quantType) => {
+      try {
+        console.log(`⚙️ [IPC] Quantize request for model: ${modelId} (${quantType})`);
+
+        const modelManager = this.getModelManager();
+        if (!modelManager?.quantizeModel) {
+          throw new Error('Model manager not available');
+        }
+
+        const result = await modelManager.quantizeModel(modelId, quantType);
+        console.log(`✅ [IPC] Quantize result for ${modelId}:`, result.success);
+        return result;
+      } catch (error) {
+        console.error(`❌ [IPC] Quantize failed for ${modelId}:`, error.message);
+        throw error; // Re-throw so renderer gets the specific error
+      }
+    });
+
+    ipcMain.handle('model:isQuantizationAvailable', async () => {
+      try {
+        const modelManager = this.getModelManager();
+        if (modelManager?.isQuantizationAvailable) {
+          return await modelManager.isQuantizationAvailable();
+        }
+        return false;
+      } catch (error) {
+        console.error('❌ [IPC] Failed to check quantization availability:', error);
+        return false;
+      }
+    });
+
     ipcMain.handle('model:getAllDownloadStates', () => {
       try {
         const modelManager = this.getModelManager();
@@ -174,6 +263,10 @@ class ModelHandlers {
     return this.serviceManager?.getService('modelManager');
   }
 
+  getBenchmarkService() {
+    return this.serviceManager?.getService('benchmarkService');
+  }
+
   cleanup() {
     console.log('🔧 Cleaning up model handlers');
     // Remove any specific event listeners if needed
@@ -29,7 +29,17 @@ class TranscriptionHandlers {
         const mergedOptions = { ...transcriptionSettings, ...options };
         
         if (service?.processFile) {
-          return await service.processFile(filePath, mergedOptions);
+          const result = await service.processFile(filePath, mergedOptions);
+
+          // NEW: Long transcripts already reached the renderer through the
+          // streamed complete event - don't serialize the whole segment list
+          // a second time through the invoke return (same 200-segment
+          // threshold the service manager streams above)
+          if (Array.isArray(result?.segments) && result.segments.length > 200) {
+            const { segments, ...slim } = result;
+            return { ...slim, segments: [], segmentsStreamed: { segmentCount: segments.length } };
+          }
+          return result;
         }
         throw new Error('Transcription service not available');
       } catch (error) {
@@ -38,6 +48,101 @@ class TranscriptionHandlers {
       }
     });
 
+    ipcMain.handle('transcription:startLive', async (event, options) => {
+      try {
+        console.log('🎙️ Starting live transcription');
+        const service = this.getTranscriptionService();
+        if (service?.startLiveTranscription) {
+          return await service.startLiveTranscription(options || {});
+        }
+        throw new Error('Live transcription not available');
+      } catch (error) {
+        console.error('❌ Failed to start live transcription:', error);
+        throw error;
+      }
+    });
+
+    ipcMain.handle('transcription:stopLive', async () => {
+      try {
+        const service = this.getTranscriptionService();
+        return await service?.stopLiveTranscription?.() || { success: false };
+      } catch (error) {
+        console.error('❌ Failed to stop live transcription:', error);
+        return { success: false, error: error.message };
+      }
+    });
+
+    ipcMain.handle('transcription:getLiveStatus', () => {
+      try {
+        const service = this.getTranscriptionService();
+        return service?.getLiveTranscriptionStatus?.() || { running: false };
+      } catch (error) {
+        return { running: false, error: error.message };
+      }
+    });
+
+    ipcMain.handle('transcription:getQueueState', () => {
+      try {
+        const service = this.getTranscriptionService();
+        return service?.getQueueState?.() || { running: [], queued: [] };
+      } catch (error) {
+        console.error('❌ Failed to get queue state:', error);
+        return { running: [], queued: [], error: error.message };
+      }
+    });
+
+    // NEW: Indexed history - metadata-only listings, lazy full bodies, and
+    // time-coded full-text search across every stored transcript
+    ipcMain.handle('transcription:getHistory', async (event, limit) => {
+      try {
+        const service = this.getTranscriptionService();
+        return await service?.getTranscriptionHistory?.(limit) || [];
+      } catch (error) {
+        console.error('❌ Failed to get transcription history:', error);
+        return [];
+      }
+    });
+
+    ipcMain.handle('transcription:getTranscription', async (event, transcriptionId) => {
+      try {
+        const service = this.getTranscriptionService();
+        return await service?.getTranscription?.(transcriptionId) || null;
+      } catch (error) {
+        console.error('❌ Failed to get transcription:', error);
+        return null;
+      }
+    });
+
+    ipcMain.handle('transcription:deleteTranscription', async (event, transcriptionId) => {
+      try {
+        const service = this.getTranscriptionService();
+        return { success: !!(await service?.deleteTranscription?.(transcriptionId)) };
+      } catch (error) {
+        console.error('❌ Failed to delete transcription:', error);
+        return { success: false, error: error.message };
+      }
+    });
+
+    ipcMain.handle('transcription:clearHistory', async () => {
+      try {
+        const service = this.getTranscriptionService();
+        return { success: !!(await service?.clearHistory?.()) };
+      } catch (error) {
+        console.error('❌ Failed to clear transcription history:', error);
+        return { success: false, error: error.message };
+      }
+    });
+
+    ipcMain.handle('transcription:search', async (event, query, limit) => {
+      try {
+        const service = this.getTranscriptionService();
+        return await service?.searchTranscriptions?.(query, limit) || [];
+      } catch (error) {
+        console.error('❌ Transcript search failed:', error);
+        return [];
+      }
+    });
+
     ipcMain.handle('transcription:stop', (event, transcriptionId) => {
       try {
         const service = this.getTranscriptionService();
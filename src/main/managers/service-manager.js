@@ -2,6 +2,10 @@
 const EventEmitter = require('events');
 const { createScreenRecorderSystem, createPlatformAwareScreenRecorderSystem } = require('../screen-recorder');
 
+// NEW: Segments per transcription:segmentBatch IPC message - keeps peak
+// message size constant no matter how long the transcript is
+const SEGMENT_STREAM_BATCH_SIZE = 200;
+
 class ServiceManager extends EventEmitter {
   constructor() {
     super();
@@ -16,13 +20,19 @@ class ServiceManager extends EventEmitter {
     try {
       // Initialize services in order of dependency
       await this.initializeModelManager();
+      await this.initializeBenchmarkService();
       await this.initializeTranscriptionService();
       await this.initializeSettingsService();
       await this.initializeExportService();
       await this.initializeEnhancedDeviceManager();
       await this.initializePlatformAwareScreenRecorder();
       await this.initializeSpeakerRecognitionService();
-      
+      this.initializeRecordingPipeline();
+
+      // NEW: One-time thread/backend calibration for machines that have
+      // never been tuned (runs in the background, off the startup path)
+      this.scheduleThreadCalibration();
+
       console.log('✅ Services initialization completed');
       return true;
     } catch (error) {
@@ -45,6 +55,46 @@ class ServiceManager extends EventEmitter {
     }
   }
 
+  async initializeBenchmarkService() {
+    try {
+      console.log('🔧 Initializing Benchmark Service...');
+      const BenchmarkService = require('../services/benchmark-service');
+      this.services.benchmarkService = new BenchmarkService(this.services.modelManager);
+      await this.services.benchmarkService.initialize();
+      console.log('✅ Benchmark Service initialized');
+    } catch (error) {
+      console.error('❌ Benchmark Service failed:', error);
+      this.services.benchmarkService = null;
+    }
+  }
+
+  // NEW: Kick off the one-time whisper-bench calibration pass when this
+  // machine has no tuned thread count yet. Delayed so it never competes with
+  // startup work; failures just leave the conservative defaults in place.
+  scheduleThreadCalibration() {
+    const benchmarkService = this.services.benchmarkService;
+    const settingsService = this.services.settingsService;
+    if (!benchmarkService || !settingsService) {
+      return;
+    }
+    if ((settingsService.get('tunedThreads') || 0) > 0) {
+      return; // Already calibrated
+    }
+
+    const timer = setTimeout(() => {
+      benchmarkService.calibrate(settingsService)
+        .then(tuning => {
+          if (!tuning) {
+            console.log('💡 Thread calibration skipped (no bench binary or no models yet)');
+          }
+        })
+        .catch(error => {
+          console.warn('⚠️ Thread calibration failed:', error.message);
+        });
+    }, 30000);
+    if (timer.unref) timer.unref();
+  }
+
   async initializeTranscriptionService() {
     try {
       console.log('🔧 Initializing Transcription Service...');
@@ -97,6 +147,29 @@ class ServiceManager extends EventEmitter {
     }
   }
 
+  // NEW: Transcribe-while-recording pipeline - tails the recorder's audio
+  // and feeds chunks to the transcription engine during capture
+  initializeRecordingPipeline() {
+    if (!this.services.transcriptionService || !this.services.screenRecorder) {
+      console.log('💡 Recording pipeline skipped - transcription or recorder service unavailable');
+      this.services.recordingPipeline = null;
+      return;
+    }
+
+    try {
+      const RecordingTranscriptionPipeline = require('../services/recording-transcription-pipeline');
+      this.services.recordingPipeline = new RecordingTranscriptionPipeline(
+        this.services.transcriptionService,
+        this.services.settingsService
+      );
+      this.services.recordingPipeline.attach(this.services.screenRecorder);
+      console.log('✅ Transcribe-while-recording pipeline initialized');
+    } catch (error) {
+      console.error('❌ Recording pipeline failed:', error);
+      this.services.recordingPipeline = null;
+    }
+  }
+
   async initializeEnhancedDeviceManager() {
     try {
       console.log('🔧 Initializing Enhanced Device Manager...');
@@ -202,10 +275,13 @@ class ServiceManager extends EventEmitter {
     // Other model events
     const modelEvents = [
       'downloadQueued',
-      'downloadComplete', 
+      'downloadComplete',
       'downloadError',
       'downloadCancelled',
-      'modelDeleted'
+      'modelDeleted',
+      'quantizeStart',
+      'quantizeComplete',
+      'quantizeError'
     ];
 
     modelEvents.forEach(eventName => {
@@ -217,6 +293,17 @@ class ServiceManager extends EventEmitter {
       });
     });
 
+    // NEW: Benchmark events (hardware profiling for model selection)
+    if (this.services.benchmarkService) {
+      ['benchmarkProgress', 'benchmarkComplete'].forEach(eventName => {
+        this.services.benchmarkService.on(eventName, (data) => {
+          if (this.mainWindow && !this.mainWindow.isDestroyed()) {
+            this.mainWindow.webContents.send(`model:${eventName}`, data);
+          }
+        });
+      });
+    }
+
     console.log('✅ Model manager event forwarding set up successfully');
   }
 
@@ -224,20 +311,82 @@ class ServiceManager extends EventEmitter {
     if (!this.services.transcriptionService || !this.mainWindow) return;
 
     try {
-      const transcriptionEvents = ['progress', 'complete', 'error', 'start', 'cancelled'];
-      
+      const transcriptionEvents = ['progress', 'error', 'start', 'cancelled', 'segment', 'queueChanged'];
+
       transcriptionEvents.forEach(eventName => {
         this.services.transcriptionService.on(eventName, (data) => {
           this.mainWindow?.webContents.send(`transcription:${eventName}`, data);
         });
       });
 
+      // NEW: 'complete' is special-cased - a multi-hour diarized result is a
+      // multi-megabyte payload, and serializing it as one webContents.send
+      // stalls both processes right when the user expects results. Large
+      // results stream out as bounded segmentBatch messages followed by a
+      // slim complete; small results keep the old single-message shape.
+      this.services.transcriptionService.on('complete', (data) => {
+        this.forwardTranscriptionComplete(data).catch(error => {
+          console.error('❌ Failed to stream transcription result to renderer:', error);
+        });
+      });
+
+      // NEW: Pipeline progress while a recording is being transcribed live
+      if (this.services.recordingPipeline) {
+        ['pipelineStarted', 'pipelineProgress', 'pipelineComplete'].forEach(eventName => {
+          this.services.recordingPipeline.on(eventName, (data) => {
+            this.mainWindow?.webContents.send(`transcription:${eventName}`, data);
+          });
+        });
+      }
+
       console.log('✅ Transcription events set up');
     } catch (error) {
       console.error('❌ Failed to set up transcription events:', error);
     }
   }
 
+  // NEW: Stream a finished transcript to the renderer in bounded batches.
+  // Each batch is its own IPC message, with a setImmediate yield in between
+  // so neither process blocks on one giant serialize/deserialize; the final
+  // complete carries everything except the segments plus a marker the
+  // renderer uses to reattach the batches it accumulated.
+  async forwardTranscriptionComplete(data) {
+    const segments = data?.result?.segments;
+
+    if (!Array.isArray(segments) || segments.length <= SEGMENT_STREAM_BATCH_SIZE) {
+      this.mainWindow?.webContents.send('transcription:complete', data);
+      return;
+    }
+
+    const totalBatches = Math.ceil(segments.length / SEGMENT_STREAM_BATCH_SIZE);
+    console.log(`📡 Streaming ${segments.length} segments to the renderer in ${totalBatches} batches`);
+
+    for (let batchIndex = 0; batchIndex < totalBatches; batchIndex++) {
+      this.mainWindow?.webContents.send('transcription:segmentBatch', {
+        transcriptionId: data.transcriptionId,
+        batchIndex,
+        totalBatches,
+        segments: segments.slice(
+          batchIndex * SEGMENT_STREAM_BATCH_SIZE,
+          (batchIndex + 1) * SEGMENT_STREAM_BATCH_SIZE
+        )
+      });
+      await new Promise(resolve => setImmediate(resolve));
+    }
+
+    this.mainWindow?.webContents.send('transcription:complete', {
+      ...data,
+      result: {
+        ...data.result,
+        segments: [],
+        segmentsStreamed: {
+          batches: totalBatches,
+          segmentCount: segments.length
+        }
+      }
+    });
+  }
+
   setupEnhancedScreenRecorderEvents() {
     if (!this.services.screenRecorder || !this.mainWindow) return;
     
@@ -104,7 +104,16 @@ contextBridge.exposeInMainWorld('electronAPI', {
     getInfo: createSafeIPC('model:getInfo'),
     cancelDownload: createSafeIPC('model:cancelDownload'),
     getAllDownloadStates: createSafeIPC('model:getAllDownloadStates'),
-    
+
+    // NEW: Local quantization (whisper.cpp quantize tool)
+    quantize: createSafeIPC('model:quantize'),
+    isQuantizationAvailable: createSafeIPC('model:isQuantizationAvailable'),
+
+    // NEW: Hardware benchmarking (whisper-bench)
+    runBenchmark: createSafeIPC('model:runBenchmark'),
+    getHardwareProfile: createSafeIPC('model:getHardwareProfile'),
+    isBenchmarkAvailable: createSafeIPC('model:isBenchmarkAvailable'),
+
     // 🔴 CRITICAL: All model event listeners that return cleanup functions
     onDownloadQueued: (callback) => {
       console.log('[Preload] Setting up downloadQueued listener');
@@ -184,11 +193,53 @@ contextBridge.exposeInMainWorld('electronAPI', {
         callback(data);
       };
       ipcRenderer.on('model:modelDeleted', handler);
-      
+
       return () => {
         console.log('[Preload] Removing modelDeleted listener');
         ipcRenderer.removeListener('model:modelDeleted', handler);
       };
+    },
+
+    onQuantizeComplete: (callback) => {
+      console.log('[Preload] Setting up quantizeComplete listener');
+      const handler = (event, data) => {
+        console.log('[Preload] Model quantize complete:', data);
+        callback(data);
+      };
+      ipcRenderer.on('model:quantizeComplete', handler);
+
+      return () => {
+        console.log('[Preload] Removing quantizeComplete listener');
+        ipcRenderer.removeListener('model:quantizeComplete', handler);
+      };
+    },
+
+    onBenchmarkProgress: (callback) => {
+      console.log('[Preload] Setting up benchmarkProgress listener');
+      const handler = (event, data) => {
+        console.log('[Preload] Benchmark progress:', data);
+        callback(data);
+      };
+      ipcRenderer.on('model:benchmarkProgress', handler);
+
+      return () => {
+        console.log('[Preload] Removing benchmarkProgress listener');
+        ipcRenderer.removeListener('model:benchmarkProgress', handler);
+      };
+    },
+
+    onBenchmarkComplete: (callback) => {
+      console.log('[Preload] Setting up benchmarkComplete listener');
+      const handler = (event, data) => {
+        console.log('[Preload] Benchmark complete:', data);
+        callback(data);
+      };
+      ipcRenderer.on('model:benchmarkComplete', handler);
+
+      return () => {
+        console.log('[Preload] Removing benchmarkComplete listener');
+        ipcRenderer.removeListener('model:benchmarkComplete', handler);
+      };
     }
   },
 
@@ -197,19 +248,34 @@ contextBridge.exposeInMainWorld('electronAPI', {
     processFile: createSafeIPC('transcription:processFile'),
     start: createSafeIPC('transcription:start'),
     stop: createSafeIPC('transcription:stop'),
+    startLive: createSafeIPC('transcription:startLive'),
+    stopLive: createSafeIPC('transcription:stopLive'),
+    getLiveStatus: createSafeIPC('transcription:getLiveStatus'),
     getProviders: createSafeIPC('transcription:getProviders'),
     getActiveTranscription: createSafeIPC('transcription:getActiveTranscription'),
     setActiveTranscription: createSafeIPC('transcription:setActiveTranscription'),
     updateActiveTranscription: createSafeIPC('transcription:updateActiveTranscription'),
     clearActiveTranscription: createSafeIPC('transcription:clearActiveTranscription'),
-    
+    getQueueState: createSafeIPC('transcription:getQueueState'),
+    getHistory: createSafeIPC('transcription:getHistory'),
+    getTranscription: createSafeIPC('transcription:getTranscription'),
+    deleteTranscription: createSafeIPC('transcription:deleteTranscription'),
+    clearHistory: createSafeIPC('transcription:clearHistory'),
+    search: createSafeIPC('transcription:search'),
+
     // Transcription events
     onProgress: createEventListener('transcription:progress'),
+    onSegment: createEventListener('transcription:segment'),
+    onSegmentBatch: createEventListener('transcription:segmentBatch'),
     onComplete: createEventListener('transcription:complete'),
     onError: createEventListener('transcription:error'),
     onResult: createEventListener('transcription:result'),
     onStart: createEventListener('transcription:start'),
-    onCancelled: createEventListener('transcription:cancelled')
+    onCancelled: createEventListener('transcription:cancelled'),
+    onQueueChanged: createEventListener('transcription:queueChanged'),
+    onPipelineStarted: createEventListener('transcription:pipelineStarted'),
+    onPipelineProgress: createEventListener('transcription:pipelineProgress'),
+    onPipelineComplete: createEventListener('transcription:pipelineComplete')
   },
 
   // Audio service
@@ -284,7 +350,8 @@ contextBridge.exposeInMainWorld('electronAPI', {
   export: {
     text: createSafeIPC('export:text'),
     subtitle: createSafeIPC('export:subtitle'),
-    copy: createSafeIPC('export:copy')
+    copy: createSafeIPC('export:copy'),
+    toFile: createSafeIPC('export:toFile')
   },
 
   // Enhanced File operations with complete API
@@ -0,0 +1,310 @@
+// src/main/services/audio-chunker.js
+// NEW: Silence-aligned chunking for parallel transcription of long recordings
+//
+// Long files are split into ~5 minute chunks whose boundaries snap to the
+// nearest detected silence, so no word is cut in half. The chunks are plain
+// 16 kHz mono WAV slices of the already-converted file (stream copy, no
+// re-encode), cheap to produce and safe to transcribe independently.
+
+const { spawn } = require('child_process');
+const path = require('path');
+const fs = require('fs').promises;
+const os = require('os');
+
+// Target chunk length and how far a boundary may drift to reach a silence
+const TARGET_CHUNK_SECONDS = 300;
+const BOUNDARY_SEARCH_WINDOW = 45;
+
+// ffmpeg silencedetect tuning - conversational pauses, not just dead air
+const SILENCE_NOISE_FLOOR = '-35dB';
+const SILENCE_MIN_DURATION = 0.4;
+
+// VAD pre-filter tuning: padding keeps word onsets/decays intact, the ratio
+// gate skips the pass when there is too little silence to be worth removing
+const SPEECH_PADDING_SECONDS = 0.25;
+const VAD_MAX_SPEECH_RATIO = 0.75;
+const VAD_MAX_REGIONS = 400;
+
+class AudioChunker {
+  constructor() {
+    this.tempDir = path.join(os.tmpdir(), 'whisperdesk-chunks');
+  }
+
+  // Duration of a 16 kHz mono PCM16 WAV (the preprocessAudio output format)
+  async getWavDuration(wavPath) {
+    const stats = await fs.stat(wavPath);
+    // 16000 samples/s * 2 bytes, minus the standard 44-byte header
+    return Math.max(0, (stats.size - 44) / 32000);
+  }
+
+  // Run ffmpeg silencedetect and collect silence midpoints (candidate cuts)
+  async detectSilences(wavPath) {
+    return new Promise((resolve) => {
+      const args = [
+        '-i', wavPath,
+        '-af', `silencedetect=noise=${SILENCE_NOISE_FLOOR}:d=${SILENCE_MIN_DURATION}`,
+        '-f', 'null',
+        '-'
+      ];
+
+      const ffmpegProcess = spawn('ffmpeg', args, { stdio: ['pipe', 'pipe', 'pipe'] });
+
+      let stderr = '';
+      ffmpegProcess.stderr.on('data', (data) => {
+        stderr += data.toString();
+      });
+
+      ffmpegProcess.on('close', () => {
+        const silences = [];
+        let pendingStart = null;
+
+        for (const line of stderr.split('\n')) {
+          const startMatch = line.match(/silence_start:\s*([\d.]+)/);
+          const endMatch = line.match(/silence_end:\s*([\d.]+)/);
+
+          if (startMatch) {
+            pendingStart = parseFloat(startMatch[1]);
+          } else if (endMatch && pendingStart !== null) {
+            const end = parseFloat(endMatch[1]);
+            silences.push({
+              start: pendingStart,
+              end,
+              midpoint: (pendingStart + end) / 2
+            });
+            pendingStart = null;
+          }
+        }
+
+        console.log(`🔇 Detected ${silences.length} silences for chunk alignment`);
+        resolve(silences);
+      });
+
+      // No silences is not an error - the planner falls back to fixed cuts
+      ffmpegProcess.on('error', () => resolve([]));
+    });
+  }
+
+  // Plan chunk boundaries: aim for TARGET_CHUNK_SECONDS, snapping each cut to
+  // the silence midpoint closest to the ideal position within the window
+  planChunks(duration, silences) {
+    const chunks = [];
+    let chunkStart = 0;
+
+    while (duration - chunkStart > TARGET_CHUNK_SECONDS * 1.5) {
+      const idealCut = chunkStart + TARGET_CHUNK_SECONDS;
+
+      let cut = idealCut;
+      let bestDistance = BOUNDARY_SEARCH_WINDOW;
+      for (const silence of silences) {
+        const distance = Math.abs(silence.midpoint - idealCut);
+        if (distance < bestDistance) {
+          bestDistance = distance;
+          cut = silence.midpoint;
+        }
+      }
+
+      chunks.push({ start: chunkStart, duration: cut - chunkStart });
+      chunkStart = cut;
+    }
+
+    chunks.push({ start: chunkStart, duration: duration - chunkStart });
+    return chunks;
+  }
+
+  // Cut one chunk out of the converted WAV (stream copy - no re-encode)
+  async cutChunk(wavPath, chunk, outputPath) {
+    return new Promise((resolve, reject) => {
+      const args = [
+        '-ss', chunk.start.toFixed(3),
+        '-t', chunk.duration.toFixed(3),
+        '-i', wavPath,
+        '-c', 'copy',
+        '-y',
+        outputPath
+      ];
+
+      const ffmpegProcess = spawn('ffmpeg', args, { stdio: ['pipe', 'pipe', 'pipe'] });
+
+      let stderr = '';
+      ffmpegProcess.stderr.on('data', (data) => {
+        stderr += data.toString();
+      });
+
+      ffmpegProcess.on('close', (code) => {
+        if (code === 0) {
+          resolve(outputPath);
+        } else {
+          reject(new Error(`Chunk cut failed: ${stderr.split('\n').slice(-3).join('\n')}`));
+        }
+      });
+
+      ffmpegProcess.on('error', (error) => {
+        reject(new Error(`Failed to start ffmpeg for chunking: ${error.message}`));
+      });
+    });
+  }
+
+  // Split a converted WAV into silence-aligned chunk files. Returns
+  // [{ start, duration, path }] ready for parallel transcription.
+  async splitOnSilence(wavPath, transcriptionId) {
+    const duration = await this.getWavDuration(wavPath);
+    const silences = await this.detectSilences(wavPath);
+    const plan = this.planChunks(duration, silences);
+
+    if (plan.length < 2) {
+      return null; // Not worth chunking
+    }
+
+    await fs.mkdir(this.tempDir, { recursive: true });
+
+    const chunks = [];
+    for (let i = 0; i < plan.length; i++) {
+      const outputPath = path.join(this.tempDir, `chunk_${transcriptionId}_${i}.wav`);
+      await this.cutChunk(wavPath, plan[i], outputPath);
+      chunks.push({ ...plan[i], path: outputPath, index: i });
+    }
+
+    console.log(`✂️ Split ${Math.round(duration)}s recording into ${chunks.length} silence-aligned chunks`);
+    return chunks;
+  }
+
+  // NEW: Build padded speech regions (the complement of detected silences)
+  // with each region's position in the compacted, speech-only timeline
+  buildSpeechRegions(silences, duration) {
+    const regions = [];
+    let cursor = 0;
+
+    for (const silence of silences) {
+      const regionEnd = Math.min(silence.start + SPEECH_PADDING_SECONDS, duration);
+      if (regionEnd - cursor > 0.1) {
+        regions.push({ start: cursor, end: regionEnd });
+      }
+      cursor = Math.max(cursor, silence.end - SPEECH_PADDING_SECONDS);
+    }
+
+    if (duration - cursor > 0.1) {
+      regions.push({ start: cursor, end: duration });
+    }
+
+    // Merge regions the padding made overlap, then assign compacted offsets
+    const merged = [];
+    for (const region of regions) {
+      const last = merged[merged.length - 1];
+      if (last && region.start <= last.end) {
+        last.end = Math.max(last.end, region.end);
+      } else {
+        merged.push({ ...region });
+      }
+    }
+
+    let compactStart = 0;
+    for (const region of merged) {
+      region.compactStart = compactStart;
+      compactStart += region.end - region.start;
+    }
+
+    return merged;
+  }
+
+  // NEW: VAD pre-filter - extract only the speech regions of a recording into
+  // a compacted 16 kHz mono WAV in one ffmpeg pass (decode + select + resample
+  // together, no intermediate full-length file). Returns null when the audio
+  // is mostly speech anyway, so the caller keeps the normal path.
+  async extractSpeechAudio(inputPath, duration, transcriptionId) {
+    if (!duration || duration <= 0) {
+      return null;
+    }
+
+    const silences = await this.detectSilences(inputPath);
+    if (silences.length === 0) {
+      return null;
+    }
+
+    const regions = this.buildSpeechRegions(silences, duration);
+    if (regions.length === 0 || regions.length > VAD_MAX_REGIONS) {
+      return null;
+    }
+
+    const speechDuration = regions.reduce((sum, r) => sum + (r.end - r.start), 0);
+    const speechRatio = speechDuration / duration;
+    if (speechRatio > VAD_MAX_SPEECH_RATIO) {
+      console.log(`🔊 Audio is ${Math.round(speechRatio * 100)}% speech - skipping VAD pre-filter`);
+      return null;
+    }
+
+    await fs.mkdir(this.tempDir, { recursive: true });
+    const outputPath = path.join(this.tempDir, `speech_${transcriptionId}.wav`);
+
+    const selectExpr = regions
+      .map(r => `between(t,${r.start.toFixed(3)},${r.end.toFixed(3)})`)
+      .join('+');
+
+    await new Promise((resolve, reject) => {
+      const args = [
+        '-i', inputPath,
+        '-vn',
+        '-af', `aselect='${selectExpr}',asetpts=N/SR/TB`,
+        '-ar', '16000',
+        '-ac', '1',
+        '-f', 'wav',
+        '-y',
+        outputPath
+      ];
+
+      const ffmpegProcess = spawn('ffmpeg', args, { stdio: ['pipe', 'pipe', 'pipe'] });
+
+      let stderr = '';
+      ffmpegProcess.stderr.on('data', (data) => {
+        stderr += data.toString();
+      });
+
+      ffmpegProcess.on('close', (code) => {
+        if (code === 0) {
+          resolve();
+        } else {
+          reject(new Error(`Speech extraction failed: ${stderr.split('\n').slice(-3).join('\n')}`));
+        }
+      });
+
+      ffmpegProcess.on('error', (error) => {
+        reject(new Error(`Failed to start ffmpeg for VAD: ${error.message}`));
+      });
+    });
+
+    console.log(`🔊 VAD pre-filter: ${Math.round(duration)}s -> ${Math.round(speechDuration)}s of speech (${regions.length} regions)`);
+
+    return {
+      path: outputPath,
+      regions,
+      speechDuration,
+      totalDuration: duration
+    };
+  }
+
+  // NEW: Map a timestamp from the compacted speech-only timeline back to the
+  // original recording
+  mapCompactTimeToOriginal(time, regions) {
+    for (const region of regions) {
+      const length = region.end - region.start;
+      if (time <= region.compactStart + length) {
+        return region.start + Math.max(0, time - region.compactStart);
+      }
+    }
+    // Past the last region - clamp to the end of the final one
+    const last = regions[regions.length - 1];
+    return last ? last.end : time;
+  }
+
+  // Delete chunk temp files (best effort)
+  async cleanupChunks(chunks) {
+    for (const chunk of chunks || []) {
+      try {
+        await fs.unlink(chunk.path);
+      } catch (error) {
+        // Temp file already gone - fine
+      }
+    }
+  }
+}
+
+module.exports = AudioChunker;
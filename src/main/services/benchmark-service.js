@@ -0,0 +1,282 @@
+// src/main/services/benchmark-service.js
+// NEW: Hardware benchmark runner for model selection guidance
+//
+// Wraps the whisper.cpp bench tool (staged next to whisper-cli by the build
+// scripts) to measure how fast this machine's encoder runs each installed
+// model at different thread counts. Results are stored as a hardware profile
+// so the Models tab can show an expected realtime factor per model instead of
+// users guessing what their machine can handle.
+
+const { EventEmitter } = require('events');
+const { spawn } = require('child_process');
+const path = require('path');
+const fs = require('fs').promises;
+const os = require('os');
+const Store = require('electron-store');
+
+// whisper-bench encodes one synthetic 30-second mel window
+const BENCH_WINDOW_SECONDS = 30;
+const BENCH_TIMEOUT = 5 * 60 * 1000;
+
+class BenchmarkService extends EventEmitter {
+  constructor(modelManager) {
+    super();
+    this.modelManager = modelManager;
+    this.store = new Store({ name: 'hardware-profile' });
+    this.binaryManager = null;
+    this.running = false;
+  }
+
+  async initialize() {
+    const available = await this.isAvailable();
+    if (available) {
+      console.log('✅ Benchmark service ready (whisper-bench found)');
+    } else {
+      console.log('💡 whisper-bench not found - benchmarking unavailable');
+      console.log('💡 Run: npm run build:whisper to build it');
+    }
+    return available;
+  }
+
+  getBenchBinaryPath() {
+    if (!this.binaryManager) {
+      const BinaryManagerDLL = require('./binary-manager-dll');
+      this.binaryManager = new BinaryManagerDLL();
+    }
+    const executable = process.platform === 'win32' ? 'whisper-bench.exe' : 'whisper-bench';
+    return path.join(this.binaryManager.binariesDir, executable);
+  }
+
+  async isAvailable() {
+    try {
+      await fs.access(this.getBenchBinaryPath());
+      return true;
+    } catch (error) {
+      return false;
+    }
+  }
+
+  // Thread counts worth measuring on this machine (deduplicated)
+  getThreadCounts() {
+    const cores = os.cpus().length;
+    return [...new Set([
+      Math.min(4, cores),
+      Math.max(1, Math.floor(cores / 2)),
+      cores
+    ])].sort((a, b) => a - b);
+  }
+
+  // Run whisper-bench once and parse the encoder timing
+  async runBench(modelPath, threads, extraArgs = []) {
+    const benchBinary = this.getBenchBinaryPath();
+
+    const output = await new Promise((resolve, reject) => {
+      const benchProcess = spawn(benchBinary, ['-m', modelPath, '-t', threads.toString(), ...extraArgs]);
+
+      let combined = '';
+      benchProcess.stdout.on('data', (data) => {
+        combined += data.toString();
+      });
+      benchProcess.stderr.on('data', (data) => {
+        combined += data.toString();
+      });
+
+      const timeout = setTimeout(() => {
+        benchProcess.kill('SIGTERM');
+        reject(new Error('Benchmark timeout'));
+      }, BENCH_TIMEOUT);
+
+      benchProcess.on('close', (code) => {
+        clearTimeout(timeout);
+        if (code === 0) {
+          resolve(combined);
+        } else {
+          reject(new Error(`whisper-bench exited with code ${code}`));
+        }
+      });
+
+      benchProcess.on('error', (error) => {
+        clearTimeout(timeout);
+        reject(new Error(`Failed to start whisper-bench: ${error.message}`));
+      });
+    });
+
+    const encodeMatch = output.match(/encode time\s*=\s*([\d.]+)\s*ms/) ||
+                        output.match(/total time\s*=\s*([\d.]+)\s*ms/);
+
+    if (!encodeMatch) {
+      throw new Error('Could not parse whisper-bench output');
+    }
+
+    const encodeMs = parseFloat(encodeMatch[1]);
+    return {
+      threads,
+      encodeMs: Math.round(encodeMs),
+      // How many seconds of audio this machine encodes per wall-clock second
+      realtimeFactor: encodeMs > 0
+        ? Math.round((BENCH_WINDOW_SECONDS * 1000 / encodeMs) * 10) / 10
+        : 0
+    };
+  }
+
+  // Benchmark one installed model across the machine's thread counts
+  async benchmarkModel(modelId) {
+    const modelPath = await this.modelManager.getCompatibleModelPath(modelId);
+    const runs = [];
+
+    for (const threads of this.getThreadCounts()) {
+      console.log(`📊 Benchmarking ${modelId} with ${threads} threads...`);
+      runs.push(await this.runBench(modelPath, threads));
+    }
+
+    const best = runs.reduce((a, b) => (b.realtimeFactor > a.realtimeFactor ? b : a));
+    return { modelId, runs, best };
+  }
+
+  // Benchmark every installed model and persist the hardware profile
+  async runFullBenchmark() {
+    if (this.running) {
+      throw new Error('A benchmark is already running');
+    }
+    if (!(await this.isAvailable())) {
+      throw new Error('whisper-bench not found. Run: npm run build:whisper');
+    }
+
+    this.running = true;
+    try {
+      const installedModels = await this.modelManager.getInstalledModels();
+      if (installedModels.length === 0) {
+        throw new Error('No models installed to benchmark');
+      }
+
+      const results = {};
+      let completed = 0;
+
+      for (const model of installedModels) {
+        this.emit('benchmarkProgress', {
+          modelId: model.id,
+          completed,
+          total: installedModels.length
+        });
+
+        try {
+          results[model.id] = await this.benchmarkModel(model.id);
+        } catch (error) {
+          console.warn(`⚠️ Benchmark failed for ${model.id}: ${error.message}`);
+        }
+        completed++;
+      }
+
+      const profile = {
+        platform: process.platform,
+        arch: process.arch,
+        cpuModel: os.cpus()[0]?.model || 'unknown',
+        cpuCores: os.cpus().length,
+        totalMemoryGB: Math.round(os.totalmem() / 1024 / 1024 / 1024),
+        benchmarkedAt: new Date().toISOString(),
+        results
+      };
+
+      this.store.set('profile', profile);
+      console.log(`✅ Hardware profile saved (${Object.keys(results).length} models benchmarked)`);
+      this.emit('benchmarkComplete', profile);
+
+      return profile;
+    } finally {
+      this.running = false;
+    }
+  }
+
+  // NEW: One-time thread/backend calibration. Probes the smallest installed
+  // model at each candidate thread count (short encode runs, seconds each)
+  // plus one CPU-only run on builds that accept -ng, and writes the winner to
+  // the settings store so every later transcription job uses the tuned values
+  // instead of the conservative 4-thread cap.
+  async calibrate(settingsService) {
+    if (this.running) {
+      throw new Error('A benchmark is already running');
+    }
+    if (!(await this.isAvailable())) {
+      return null;
+    }
+
+    const installedModels = await this.modelManager.getInstalledModels();
+    if (installedModels.length === 0) {
+      return null;
+    }
+
+    this.running = true;
+    try {
+      const smallest = installedModels.reduce((a, b) =>
+        ((a.size || Infinity) <= (b.size || Infinity) ? a : b));
+      const modelPath = await this.modelManager.getCompatibleModelPath(smallest.id);
+
+      console.log(`⚙️ Calibrating thread count with ${smallest.id}...`);
+      const runs = [];
+      for (const threads of this.getThreadCounts()) {
+        try {
+          runs.push(await this.runBench(modelPath, threads));
+        } catch (error) {
+          console.warn(`⚠️ Calibration run at ${threads} threads failed: ${error.message}`);
+        }
+      }
+      if (runs.length === 0) {
+        return null;
+      }
+
+      const best = runs.reduce((a, b) => (b.realtimeFactor > a.realtimeFactor ? b : a));
+
+      // Backend check: the runs above used the build's default backend (GPU
+      // on Metal builds). If a CPU-only run beats it, the GPU path is broken
+      // or slower on this machine and jobs should opt out of it.
+      let backend = 'auto';
+      try {
+        const cpuRun = await this.runBench(modelPath, best.threads, ['-ng']);
+        backend = cpuRun.encodeMs < best.encodeMs ? 'cpu' : 'gpu';
+      } catch (error) {
+        console.log('💡 whisper-bench has no -ng flag - backend stays on auto');
+      }
+
+      const tuning = {
+        threads: best.threads,
+        backend,
+        realtimeFactor: best.realtimeFactor,
+        modelId: smallest.id,
+        calibratedAt: new Date().toISOString()
+      };
+
+      settingsService.set('tunedThreads', best.threads);
+      settingsService.set('tunedBackend', backend);
+      this.store.set('tuning', tuning);
+
+      console.log(`✅ Calibration complete: ${best.threads} threads, backend '${backend}' (${best.realtimeFactor}x realtime on ${smallest.id})`);
+      this.emit('calibrationComplete', tuning);
+      return tuning;
+    } finally {
+      this.running = false;
+    }
+  }
+
+  getHardwareProfile() {
+    return this.store.get('profile') || null;
+  }
+
+  // Expected transcription speed for a model on this machine, from the stored
+  // profile. Quantized variants fall back to their base model's measurement.
+  getExpectedSpeed(modelId) {
+    const profile = this.getHardwareProfile();
+    if (!profile) return null;
+
+    const result = profile.results[modelId] ||
+                   profile.results[modelId.replace(/-q\d_\d$/, '')];
+    if (!result) return null;
+
+    return {
+      realtimeFactor: result.best.realtimeFactor,
+      threads: result.best.threads,
+      benchmarkedAt: profile.benchmarkedAt
+    };
+  }
+}
+
+module.exports = BenchmarkService;
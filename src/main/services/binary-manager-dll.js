@@ -11,6 +11,7 @@ class BinaryManagerDLL {
     this.arch = os.arch();
     this.binariesDir = this.getBinariesDirectory();
     this.dependencyCheckCache = new Map();
+    this.gpuBackendCache = null; // NEW: cached GPU backend DLL probe result
     
     // Define required files for each platform
     this.requiredFiles = this.getRequiredFiles();
@@ -49,11 +50,19 @@ class BinaryManagerDLL {
           'SDL2.dll'
         ],
         executable: 'whisper-cli.exe',  // ← UPDATED: Using whisper-cli.exe
+        // NEW: Optional GPU backend DLLs - ggml discovers and loads these at
+        // runtime next to ggml-cpu.dll, falling back to CPU when absent
+        gpuBackends: [
+          'ggml-cuda.dll',
+          'ggml-vulkan.dll'
+        ],
         optional: [
           'whisper-stream.exe',
           'whisper-server.exe',
           'whisper-bench.exe',
-          'quantize.exe'
+          'quantize.exe',
+          'ggml-cuda.dll',
+          'ggml-vulkan.dll'
         ],
         all: [
           'whisper.dll',
@@ -68,8 +77,14 @@ class BinaryManagerDLL {
       // macOS/Linux - use single binary (working approach)
       return {
         dlls: [],
+        gpuBackends: [],
         executable: 'whisper-cli',  // ← UPDATED: Using whisper-cli (no .exe)
-        optional: [],
+        optional: [
+          'whisper-server',
+          'whisper-stream',
+          'whisper-bench',
+          'quantize'
+        ],
         all: ['whisper-cli']
       };
     }
@@ -118,8 +133,11 @@ class BinaryManagerDLL {
           console.warn(`⚠️ DLL dependency issues: ${dependencyCheck.error}`);
           return false;
         }
+
+        // NEW: Report which optional GPU backend DLLs shipped with this build
+        await this.detectGpuBackends();
       }
-      
+
       return true;
     } catch (error) {
       console.error(`❌ Binary verification failed: ${error.message}`);
@@ -192,6 +210,54 @@ class BinaryManagerDLL {
     }
   }
 
+  /**
+   * NEW: Detect optional GPU backend DLLs (ggml-cuda.dll / ggml-vulkan.dll)
+   *
+   * ggml loads backend DLLs from the executable's directory at runtime and
+   * falls back to ggml-cpu.dll when a backend is missing or its driver is
+   * unavailable, so these are never required - this just validates which
+   * ones shipped and which one whisper-cli will try first.
+   */
+  async detectGpuBackends() {
+    if (this.gpuBackendCache) {
+      return this.gpuBackendCache;
+    }
+
+    const result = {
+      available: [],
+      selected: null,
+      fallback: 'cpu'
+    };
+
+    for (const fileName of (this.requiredFiles.gpuBackends || [])) {
+      const dllPath = path.join(this.binariesDir, fileName);
+      try {
+        const stats = await fs.stat(dllPath);
+        if (stats.size === 0) {
+          console.warn(`⚠️ GPU backend DLL is empty, ignoring: ${fileName}`);
+          continue;
+        }
+        // ggml-cuda.dll → 'cuda', ggml-vulkan.dll → 'vulkan'
+        const backend = fileName.replace(/^ggml-/, '').replace(/\.dll$/, '');
+        result.available.push(backend);
+        console.log(`✅ GPU backend DLL found: ${fileName} (${Math.round(stats.size / 1024)} KB)`);
+      } catch {
+        // Optional - absence means CPU-only, which is the default build
+      }
+    }
+
+    if (result.available.length > 0) {
+      // ggml probes backends in its own order; CUDA wins over Vulkan when both ship
+      result.selected = result.available.includes('cuda') ? 'cuda' : result.available[0];
+      console.log(`🚀 GPU backend available: ${result.selected} (CPU fallback if the driver is missing)`);
+    } else {
+      console.log('💡 No GPU backend DLLs found - using CPU backend');
+    }
+
+    this.gpuBackendCache = result;
+    return result;
+  }
+
   /**
    * Test binary functionality
    */
@@ -401,6 +467,7 @@ class BinaryManagerDLL {
       if (status.binaryExecutable) {
         if (this.platform === 'win32') {
           status.dependencyCheck = await this.checkWindowsDLLs();
+          status.gpuBackends = await this.detectGpuBackends(); // NEW: optional GPU backend DLLs
         } else {
           status.dependencyCheck = { success: true, method: 'not-needed' };
         }
@@ -5,6 +5,16 @@ const os = require('os');
 const { spawn } = require('child_process');
 const { execAsync } = require('../utils/exec-utils');
 
+// NEW: Windowed streaming mode for very long audio. diarize-cli clusters all
+// embedding windows in one pass, which grows super-linearly with duration and
+// has OOMed 8GB machines on 3-4 hour recordings. Above the threshold the
+// audio is diarized in bounded windows and speakers are merged across window
+// boundaries, keeping memory flat regardless of total duration.
+const STREAMING_THRESHOLD_SECONDS = 30 * 60;  // single pass below this
+const WINDOW_SECONDS = 10 * 60;               // each diarize-cli run sees at most this
+const WINDOW_OVERLAP_SECONDS = 30;            // shared span used to align speakers
+const EMBEDDING_MATCH_THRESHOLD = 0.6;        // cosine floor for centroid merging
+
 class EnhancedDiarizationBinaryManager {
   constructor() {
     this.platform = process.platform;
@@ -19,6 +29,16 @@ class EnhancedDiarizationBinaryManager {
     this.modelFiles = this.getRequiredModels();
     
     this.dependencyCheckCache = new Map();
+
+    // Persistent daemon state - ONNX sessions are created once per daemon
+    // lifetime instead of once per file (several seconds saved per job)
+    this.daemonProcess = null;
+    this.daemonJobQueue = Promise.resolve();
+    this.daemonIdleTimer = null;
+    this.batchModeSupport = null; // null = not probed yet
+    this.binaryHelpCache = null;
+    this.executionProviderCache = null; // Resolved provider after probing
+    this.embeddingOutputSupport = null; // null = not probed yet
   }
 
   getBinariesDirectory() {
@@ -71,13 +91,17 @@ class EnhancedDiarizationBinaryManager {
           'onnxruntime.dll',
         ],
         optional: [
-          'onnxruntime_providers_shared.dll'
+          'onnxruntime_providers_shared.dll',
+          // Hardware execution provider (DirectML) - optional, CPU fallback
+          'DirectML.dll'
         ],
         all: [
           'diarize-cli.exe',
           'onnxruntime.dll',
           'onnxruntime_providers_shared.dll'
-        ]
+        ],
+        // Provider library that must be present to attempt GPU execution
+        executionProvider: { name: 'directml', library: 'DirectML.dll' }
       };
     } else if (this.platform === 'darwin') {
       return {
@@ -94,7 +118,9 @@ class EnhancedDiarizationBinaryManager {
         all: [
           'diarize-cli',
           'libonnxruntime.dylib'
-        ]
+        ],
+        // CoreML ships inside libonnxruntime.dylib - no extra library needed
+        executionProvider: { name: 'coreml', library: null }
       };
     } else {
       return {
@@ -104,13 +130,16 @@ class EnhancedDiarizationBinaryManager {
           'libonnxruntime.so'
         ],
         optional: [
-          'libonnxruntime_providers_shared.so'
+          'libonnxruntime_providers_shared.so',
+          // Hardware execution provider (CUDA) - optional, CPU fallback
+          'libonnxruntime_providers_cuda.so'
         ],
         all: [
           'diarize-cli',
           'libonnxruntime.so',
           'libonnxruntime_providers_shared.so'
-        ]
+        ],
+        executionProvider: { name: 'cuda', library: 'libonnxruntime_providers_cuda.so' }
       };
     }
   }
@@ -385,8 +414,598 @@ class EnhancedDiarizationBinaryManager {
     }
   }
 
-  // ENHANCED: Better diarization with aggressive multi-speaker detection
+  // NEW: Probe whether the installed diarize-cli supports persistent serve
+  // mode (--serve reads one JSON job per stdin line, answers one JSON line per
+  // job). Older binaries without the flag keep the per-file spawn path.
+  async getBinaryHelp() {
+    if (this.binaryHelpCache !== null) {
+      return this.binaryHelpCache;
+    }
+
+    try {
+      const binaryPath = this.getDiarizationBinaryPath();
+      const { stdout, stderr } = await execAsync(`"${binaryPath}" --help`, {
+        timeout: 10000,
+        cwd: this.binariesDir,
+        env: this.getDaemonEnv()
+      });
+      this.binaryHelpCache = stdout + stderr;
+    } catch (error) {
+      this.binaryHelpCache = '';
+    }
+
+    return this.binaryHelpCache;
+  }
+
+  async supportsServeMode() {
+    if (this.batchModeSupport !== null) {
+      return this.batchModeSupport;
+    }
+
+    const help = await this.getBinaryHelp();
+    this.batchModeSupport = help.includes('--serve');
+    console.log(`🎭 diarize-cli serve mode supported: ${this.batchModeSupport}`);
+    return this.batchModeSupport;
+  }
+
+  // NEW: Probe whether the installed diarize-cli can emit the per-speaker
+  // embedding vectors it already computes via embedding-1.0.onnx
+  // (speaker_embeddings map in the result JSON). Older binaries without the
+  // flag simply return no embeddings and cross-recording speaker recognition
+  // stays off.
+  async supportsEmbeddingOutput() {
+    if (this.embeddingOutputSupport !== null) {
+      return this.embeddingOutputSupport;
+    }
+
+    const help = await this.getBinaryHelp();
+    this.embeddingOutputSupport = help.includes('--emit-embeddings');
+    console.log(`🎭 diarize-cli embedding output supported: ${this.embeddingOutputSupport}`);
+    return this.embeddingOutputSupport;
+  }
+
+  // NEW: Resolve the hardware execution provider for this machine:
+  // CoreML on macOS, DirectML on Windows, CUDA on Linux - each only when the
+  // binary advertises --execution-provider and the provider library is
+  // present. Anything else (or a runtime failure) runs on CPU.
+  async detectExecutionProvider() {
+    if (this.executionProviderCache !== null) {
+      return this.executionProviderCache;
+    }
+
+    const providerInfo = this.requiredFiles.executionProvider;
+    let provider = 'cpu';
+
+    if (providerInfo) {
+      const help = await this.getBinaryHelp();
+
+      if (help.includes('--execution-provider')) {
+        if (!providerInfo.library) {
+          provider = providerInfo.name;
+        } else {
+          try {
+            await fs.access(path.join(this.binariesDir, providerInfo.library));
+            provider = providerInfo.name;
+          } catch (error) {
+            console.log(`💡 ${providerInfo.library} not found - diarization stays on CPU`);
+          }
+        }
+      } else {
+        console.log('💡 diarize-cli has no --execution-provider flag - CPU only');
+      }
+    }
+
+    console.log(`🎭 Diarization execution provider: ${provider}`);
+    this.executionProviderCache = provider;
+    return provider;
+  }
+
+  // Called when a hardware provider fails at runtime so retries use CPU
+  demoteToCpuProvider(reason) {
+    if (this.executionProviderCache && this.executionProviderCache !== 'cpu') {
+      console.warn(`⚠️ Execution provider '${this.executionProviderCache}' failed (${reason}), falling back to CPU`);
+      this.executionProviderCache = 'cpu';
+    }
+  }
+
+  getDaemonEnv() {
+    return {
+      ...process.env,
+      ...(this.platform === 'darwin' && {
+        DYLD_LIBRARY_PATH: `${this.binariesDir}:${process.env.DYLD_LIBRARY_PATH || ''}`,
+        DYLD_FALLBACK_LIBRARY_PATH: this.binariesDir
+      }),
+      ...(this.platform === 'linux' && {
+        LD_LIBRARY_PATH: `${this.binariesDir}:${process.env.LD_LIBRARY_PATH || ''}`
+      })
+    };
+  }
+
+  // NEW: Start (or reuse) the persistent diarization daemon. The ONNX
+  // sessions for segmentation-3.0 and embedding-1.0 are created once here.
+  async ensureDaemonStarted() {
+    if (this.daemonProcess && this.daemonProcess.exitCode === null) {
+      return this.daemonProcess;
+    }
+
+    const binaryPath = this.getDiarizationBinaryPath();
+    const executionProvider = await this.detectExecutionProvider();
+    const args = [
+      '--serve',
+      '--segment-model', this.getModelPath('segmentation-3.0'),
+      '--embedding-model', this.getModelPath('embedding-1.0'),
+      '--output-format', 'json'
+    ];
+
+    if (executionProvider !== 'cpu') {
+      args.push('--execution-provider', executionProvider);
+    }
+
+    if (await this.supportsEmbeddingOutput()) {
+      args.push('--emit-embeddings');
+    }
+
+    console.log('🚀 Starting persistent diarization daemon (ONNX sessions created once)');
+    console.log(`   Args: ${args.join(' ')}`);
+
+    const daemonProcess = spawn(binaryPath, args, {
+      cwd: this.binariesDir,
+      stdio: ['pipe', 'pipe', 'pipe'],
+      env: this.getDaemonEnv()
+    });
+
+    daemonProcess.stderr.on('data', (data) => {
+      const output = data.toString().trim();
+      if (output) {
+        console.log(`📝 diarize-cli daemon: ${output}`);
+      }
+    });
+
+    daemonProcess.on('close', (code) => {
+      if (this.daemonProcess === daemonProcess) {
+        console.log(`🏁 Diarization daemon exited with code: ${code}`);
+        this.daemonProcess = null;
+        this.clearDaemonIdleTimer();
+      }
+    });
+
+    daemonProcess.on('error', (error) => {
+      console.error(`❌ Diarization daemon failed: ${error.message}`);
+    });
+
+    this.daemonProcess = daemonProcess;
+    this.resetDaemonIdleTimer();
+    return daemonProcess;
+  }
+
+  // NEW: Run one job through the resident daemon. Jobs are serialized through
+  // a promise chain so stdout lines map unambiguously to requests.
+  async performDiarizationViaDaemon(audioPath, options = {}) {
+    const job = this.daemonJobQueue.then(async () => {
+      const daemonProcess = await this.ensureDaemonStarted();
+      this.clearDaemonIdleTimer();
+
+      const request = JSON.stringify({
+        audio: audioPath,
+        threshold: options.threshold ?? 0.01,
+        max_speakers: options.maxSpeakers ?? 10
+      });
+
+      console.log(`🎭 Daemon diarization job: ${path.basename(audioPath)}`);
+
+      try {
+        return await new Promise((resolve, reject) => {
+          let buffer = '';
+
+          const onData = (data) => {
+            buffer += data.toString();
+            const newlineIndex = buffer.indexOf('\n');
+            if (newlineIndex !== -1) {
+              cleanup();
+              try {
+                resolve(JSON.parse(buffer.substring(0, newlineIndex)));
+              } catch (parseError) {
+                reject(new Error(`Failed to parse daemon response: ${parseError.message}`));
+              }
+            }
+          };
+
+          const onClose = () => {
+            cleanup();
+            reject(new Error('Diarization daemon exited mid-job'));
+          };
+
+          const cleanup = () => {
+            daemonProcess.stdout.removeListener('data', onData);
+            daemonProcess.removeListener('close', onClose);
+          };
+
+          daemonProcess.stdout.on('data', onData);
+          daemonProcess.once('close', onClose);
+          daemonProcess.stdin.write(request + '\n');
+        });
+      } finally {
+        this.resetDaemonIdleTimer();
+      }
+    });
+
+    // Keep the chain alive even when a job rejects
+    this.daemonJobQueue = job.catch(() => {});
+    return job;
+  }
+
+  resetDaemonIdleTimer() {
+    this.clearDaemonIdleTimer();
+    this.daemonIdleTimer = setTimeout(() => {
+      console.log('💤 Diarization daemon idle, shutting down');
+      this.stopDaemon();
+    }, 5 * 60 * 1000);
+    if (this.daemonIdleTimer.unref) this.daemonIdleTimer.unref();
+  }
+
+  clearDaemonIdleTimer() {
+    if (this.daemonIdleTimer) {
+      clearTimeout(this.daemonIdleTimer);
+      this.daemonIdleTimer = null;
+    }
+  }
+
+  stopDaemon() {
+    this.clearDaemonIdleTimer();
+    if (this.daemonProcess && this.daemonProcess.exitCode === null) {
+      this.daemonProcess.kill('SIGTERM');
+    }
+    this.daemonProcess = null;
+  }
+
+  // ENHANCED: Better diarization with aggressive multi-speaker detection.
+  // Long recordings go through the windowed streaming path; anything that is
+  // short - or whose duration we cannot determine - keeps the single pass.
   async performDiarization(audioPath, options = {}) {
+    const duration = this.getWavDuration(audioPath);
+    if (duration && duration > STREAMING_THRESHOLD_SECONDS && options.streaming !== false) {
+      return this.performWindowedDiarization(audioPath, options, duration);
+    }
+
+    return this.performDiarizationSinglePass(audioPath, options);
+  }
+
+  // One diarize-cli invocation over the whole file - daemon when the binary
+  // supports serve mode, fresh process otherwise
+  async performDiarizationSinglePass(audioPath, options = {}) {
+    // Prefer the persistent daemon when the binary supports it - batch runs
+    // then pay ONNX session setup and graph optimization exactly once
+    if (await this.supportsServeMode()) {
+      try {
+        return await this.performDiarizationViaDaemon(audioPath, options);
+      } catch (daemonError) {
+        // Daemon errors are often transient (startup timeout, protocol
+        // hiccup, malformed audio) and say nothing about the execution
+        // provider - fall through to a one-shot on the CURRENT provider and
+        // let its catch below demote only when the provider itself fails
+        console.warn(`⚠️ Daemon diarization failed, falling back to one-shot: ${daemonError.message}`);
+        this.stopDaemon();
+      }
+    }
+
+    try {
+      return await this.performDiarizationOneShot(audioPath, options);
+    } catch (oneShotError) {
+      // A hardware execution provider that fails at runtime (driver issues,
+      // unsupported ops) should not take diarization down - retry on CPU
+      if (this.executionProviderCache && this.executionProviderCache !== 'cpu') {
+        this.demoteToCpuProvider(oneShotError.message);
+        return this.performDiarizationOneShot(audioPath, options);
+      }
+      throw oneShotError;
+    }
+  }
+
+  // NEW: Streaming diarization for multi-hour audio. The recording is
+  // processed in WINDOW_SECONDS slices with a short shared overlap; each
+  // slice is a separate bounded single-pass run (daemon when available), and
+  // window-local speakers are folded into a global roster after every window
+  // (periodic centroid merging when the binary emits embeddings, overlap
+  // agreement otherwise).
+  async performWindowedDiarization(audioPath, options, duration) {
+    const fsSync = require('fs');
+    const stride = WINDOW_SECONDS - WINDOW_OVERLAP_SECONDS;
+    const windowCount = Math.max(1, Math.ceil((duration - WINDOW_OVERLAP_SECONDS) / stride));
+    console.log(`🎭 Streaming diarization: ${Math.round(duration)}s in ${windowCount} windows of ${WINDOW_SECONDS}s`);
+
+    const tempDir = path.join(os.tmpdir(), 'whisperdesk-diarize-windows');
+    fsSync.mkdirSync(tempDir, { recursive: true });
+
+    // Global speaker roster carried across windows
+    const speakers = new Map();  // globalId -> { centroid: Float64Array|null, samples }
+    let nextSpeakerId = 0;
+    const mergedSegments = [];
+
+    try {
+      for (let index = 0; index < windowCount; index++) {
+        const windowStart = index * stride;
+        const windowDuration = Math.min(WINDOW_SECONDS, duration - windowStart);
+        if (windowDuration <= 0) break;
+
+        const windowPath = path.join(tempDir, `window_${index}.wav`);
+        this.sliceWav(audioPath, windowStart, windowDuration, windowPath);
+
+        let windowResult;
+        try {
+          windowResult = await this.performDiarizationSinglePass(windowPath, { ...options, outputFile: null });
+        } finally {
+          try { fsSync.unlinkSync(windowPath); } catch { /* best effort */ }
+        }
+
+        const windowSegments = (windowResult.segments || []).map(segment => ({
+          ...segment,
+          start_time: segment.start_time + windowStart,
+          end_time: segment.end_time + windowStart
+        }));
+
+        // Map window-local speaker ids onto the global roster
+        const localToGlobal = this.mapWindowSpeakers(
+          windowSegments,
+          windowResult.speaker_embeddings,
+          speakers,
+          mergedSegments,
+          windowStart,
+          () => nextSpeakerId++
+        );
+
+        // The first half of the overlap belongs to the previous window; keep
+        // only what this window adds beyond the cut point
+        const cutPoint = index === 0 ? 0 : windowStart + WINDOW_OVERLAP_SECONDS / 2;
+        for (const segment of windowSegments) {
+          if (segment.end_time <= cutPoint) continue;
+          mergedSegments.push({
+            ...segment,
+            start_time: Math.max(segment.start_time, cutPoint),
+            speaker_id: localToGlobal.get(segment.speaker_id) ?? segment.speaker_id
+          });
+        }
+
+        console.log(`🎭 Window ${index + 1}/${windowCount} merged (${speakers.size} global speakers so far)`);
+      }
+    } finally {
+      try { fsSync.rmSync(tempDir, { recursive: true, force: true }); } catch { /* best effort */ }
+    }
+
+    mergedSegments.sort((a, b) => a.start_time - b.start_time);
+    return {
+      segments: mergedSegments,
+      total_speakers: speakers.size,
+      total_duration: duration,
+      streaming: {
+        windows: windowCount,
+        window_seconds: WINDOW_SECONDS,
+        overlap_seconds: WINDOW_OVERLAP_SECONDS
+      }
+    };
+  }
+
+  // Decide which global speaker each window-local cluster belongs to.
+  // Preferred: cosine match of the window's speaker embeddings against the
+  // global running centroids. Fallback: agreement in the overlap span shared
+  // with the already-merged timeline - which cannot re-identify a speaker
+  // who stays silent through the whole overlap, so such speakers join the
+  // roster as new entries (embeddings avoid this entirely).
+  mapWindowSpeakers(windowSegments, windowEmbeddings, speakers, mergedSegments, windowStart, allocateId) {
+    const localIds = [...new Set(windowSegments.map(segment => segment.speaker_id))];
+    const localToGlobal = new Map();
+
+    for (const localId of localIds) {
+      const embedding = windowEmbeddings?.[localId] || windowEmbeddings?.[`speaker_${localId}`];
+
+      let globalId = null;
+      if (Array.isArray(embedding) && embedding.length > 0) {
+        globalId = this.matchByCentroid(embedding, speakers);
+      }
+      if (globalId === null && mergedSegments.length > 0) {
+        globalId = this.matchByOverlap(localId, windowSegments, mergedSegments, windowStart);
+      }
+      if (globalId === null) {
+        globalId = allocateId();
+        speakers.set(globalId, { centroid: null, samples: 0 });
+      }
+
+      // Periodic centroid merging: fold this window's evidence into the
+      // global speaker so later windows match against an up-to-date voice
+      if (Array.isArray(embedding) && embedding.length > 0) {
+        this.updateCentroid(speakers.get(globalId), embedding);
+      }
+
+      localToGlobal.set(localId, globalId);
+    }
+
+    return localToGlobal;
+  }
+
+  matchByCentroid(embedding, speakers) {
+    const norm = Math.sqrt(embedding.reduce((sum, v) => sum + v * v, 0)) || 1;
+    let bestId = null;
+    let bestScore = EMBEDDING_MATCH_THRESHOLD;
+
+    for (const [globalId, speaker] of speakers) {
+      if (!speaker.centroid || speaker.centroid.length !== embedding.length) continue;
+      let dot = 0;
+      let centroidNorm = 0;
+      for (let i = 0; i < embedding.length; i++) {
+        dot += embedding[i] * speaker.centroid[i];
+        centroidNorm += speaker.centroid[i] * speaker.centroid[i];
+      }
+      const score = dot / (norm * (Math.sqrt(centroidNorm) || 1));
+      if (score > bestScore) {
+        bestScore = score;
+        bestId = globalId;
+      }
+    }
+    return bestId;
+  }
+
+  updateCentroid(speaker, embedding) {
+    if (!speaker.centroid || speaker.centroid.length !== embedding.length) {
+      speaker.centroid = Float64Array.from(embedding);
+      speaker.samples = 1;
+      return;
+    }
+    const weight = speaker.samples / (speaker.samples + 1);
+    for (let i = 0; i < embedding.length; i++) {
+      speaker.centroid[i] = speaker.centroid[i] * weight + embedding[i] / (speaker.samples + 1);
+    }
+    speaker.samples++;
+  }
+
+  // Who spoke in the overlap span according to the already-merged timeline?
+  // The global speaker sharing the most talk time with this local cluster
+  // inside the overlap wins.
+  matchByOverlap(localId, windowSegments, mergedSegments, windowStart) {
+    const overlapEnd = windowStart + WINDOW_OVERLAP_SECONDS;
+    const overlapByGlobal = new Map();
+
+    for (const local of windowSegments) {
+      if (local.speaker_id !== localId || local.start_time >= overlapEnd) continue;
+      for (const merged of mergedSegments) {
+        if (merged.end_time <= windowStart) continue;
+        const overlap = Math.min(local.end_time, merged.end_time, overlapEnd) -
+                        Math.max(local.start_time, merged.start_time, windowStart);
+        if (overlap > 0) {
+          overlapByGlobal.set(merged.speaker_id, (overlapByGlobal.get(merged.speaker_id) || 0) + overlap);
+        }
+      }
+    }
+
+    let bestId = null;
+    let bestOverlap = 0.5;  // require at least half a second of agreement
+    for (const [globalId, overlap] of overlapByGlobal) {
+      if (overlap > bestOverlap) {
+        bestOverlap = overlap;
+        bestId = globalId;
+      }
+    }
+    return bestId;
+  }
+
+  // Duration of a 16-bit PCM WAV from its header - the enhanced pipeline
+  // always hands this manager the ffmpeg-converted 16kHz mono WAV. Non-WAV
+  // input returns null and falls back to the single-pass path.
+  getWavDuration(audioPath) {
+    const fsSync = require('fs');
+    try {
+      if (path.extname(audioPath).toLowerCase() !== '.wav') {
+        return null;
+      }
+      const fd = fsSync.openSync(audioPath, 'r');
+      try {
+        const header = Buffer.alloc(12);
+        fsSync.readSync(fd, header, 0, 12, 0);
+        if (header.toString('ascii', 0, 4) !== 'RIFF' || header.toString('ascii', 8, 12) !== 'WAVE') {
+          return null;
+        }
+
+        const fileSize = fsSync.fstatSync(fd).size;
+        let offset = 12;
+        let byteRate = null;
+        const chunkHeader = Buffer.alloc(8);
+
+        // Walk the RIFF chunks to find fmt (byte rate) and data (payload size)
+        while (offset + 8 <= fileSize) {
+          fsSync.readSync(fd, chunkHeader, 0, 8, offset);
+          const chunkId = chunkHeader.toString('ascii', 0, 4);
+          const chunkSize = chunkHeader.readUInt32LE(4);
+
+          if (chunkId === 'fmt ') {
+            const fmt = Buffer.alloc(16);
+            fsSync.readSync(fd, fmt, 0, 16, offset + 8);
+            byteRate = fmt.readUInt32LE(8);
+          } else if (chunkId === 'data' && byteRate) {
+            return chunkSize / byteRate;
+          }
+          offset += 8 + chunkSize + (chunkSize % 2);
+        }
+        return null;
+      } finally {
+        fsSync.closeSync(fd);
+      }
+    } catch {
+      return null;
+    }
+  }
+
+  // Cut one window out of a 16-bit PCM WAV by byte range - no ffmpeg round
+  // trip, and only the window's bytes are ever resident
+  sliceWav(audioPath, startSeconds, durationSeconds, outputPath) {
+    const fsSync = require('fs');
+    const fd = fsSync.openSync(audioPath, 'r');
+    try {
+      const fileSize = fsSync.fstatSync(fd).size;
+      const chunkHeader = Buffer.alloc(8);
+      let offset = 12;
+      let fmtChunk = null;
+      let dataOffset = null;
+      let dataSize = null;
+
+      while (offset + 8 <= fileSize) {
+        fsSync.readSync(fd, chunkHeader, 0, 8, offset);
+        const chunkId = chunkHeader.toString('ascii', 0, 4);
+        const chunkSize = chunkHeader.readUInt32LE(4);
+
+        if (chunkId === 'fmt ') {
+          fmtChunk = Buffer.alloc(chunkSize);
+          fsSync.readSync(fd, fmtChunk, 0, chunkSize, offset + 8);
+        } else if (chunkId === 'data') {
+          dataOffset = offset + 8;
+          dataSize = chunkSize;
+          break;
+        }
+        offset += 8 + chunkSize + (chunkSize % 2);
+      }
+
+      if (!fmtChunk || dataOffset === null) {
+        throw new Error('Could not locate fmt/data chunks in WAV file');
+      }
+
+      const byteRate = fmtChunk.readUInt32LE(8);
+      const blockAlign = fmtChunk.readUInt16LE(12);
+      const alignDown = (bytes) => Math.floor(bytes / blockAlign) * blockAlign;
+
+      const sliceStart = Math.min(alignDown(startSeconds * byteRate), dataSize);
+      const sliceBytes = Math.min(alignDown(durationSeconds * byteRate), dataSize - sliceStart);
+
+      // Minimal RIFF/fmt/data header followed by the window's samples
+      const header = Buffer.alloc(44);
+      header.write('RIFF', 0, 'ascii');
+      header.writeUInt32LE(36 + sliceBytes, 4);
+      header.write('WAVE', 8, 'ascii');
+      header.write('fmt ', 12, 'ascii');
+      header.writeUInt32LE(16, 16);
+      fmtChunk.copy(header, 20, 0, 16);
+      header.write('data', 36, 'ascii');
+      header.writeUInt32LE(sliceBytes, 40);
+
+      const outFd = fsSync.openSync(outputPath, 'w');
+      try {
+        fsSync.writeSync(outFd, header);
+        const buffer = Buffer.alloc(1024 * 1024);
+        let remaining = sliceBytes;
+        let readOffset = dataOffset + sliceStart;
+        while (remaining > 0) {
+          const bytes = fsSync.readSync(fd, buffer, 0, Math.min(buffer.length, remaining), readOffset);
+          if (bytes <= 0) break;
+          fsSync.writeSync(outFd, buffer, 0, bytes);
+          readOffset += bytes;
+          remaining -= bytes;
+        }
+      } finally {
+        fsSync.closeSync(outFd);
+      }
+    } finally {
+      fsSync.closeSync(fd);
+    }
+  }
+
+  // One-shot path: fresh process (and fresh ONNX sessions) per file
+  async performDiarizationOneShot(audioPath, options = {}) {
     const {
       maxSpeakers = 10,
       threshold = 0.01,  // MUCH lower default threshold
@@ -402,6 +1021,7 @@ class EnhancedDiarizationBinaryManager {
     await this.verifyDiarizationSetup(audioPath, segmentModelPath, embeddingModelPath);
 
     // ENHANCED: More aggressive parameters for multi-speaker detection
+    const executionProvider = await this.detectExecutionProvider();
     const args = [
       '--audio', audioPath,
       '--segment-model', segmentModelPath,
@@ -411,6 +1031,14 @@ class EnhancedDiarizationBinaryManager {
       '--output-format', 'json'
     ];
 
+    if (executionProvider !== 'cpu') {
+      args.push('--execution-provider', executionProvider);
+    }
+
+    if (await this.supportsEmbeddingOutput()) {
+      args.push('--emit-embeddings');
+    }
+
     if (outputFile) {
       args.push('--output', outputFile);
     }
@@ -68,6 +68,13 @@ class DiarizationService {
       throw new Error('Diarization system not available. Multi-speaker detection disabled.');
     }
 
+    // Windowed streaming for long audio lives in
+    // diarization-binary-manager.js, which is the path the enhanced
+    // provider actually runs through
+    return this.runDiarizeCli(audioPath, options);
+  }
+
+  runDiarizeCli(audioPath, options = {}) {
     const {
       threshold = 0.01,
       maxSpeakers = 10,
@@ -92,7 +99,7 @@ class DiarizationService {
     }
 
     return new Promise((resolve, reject) => {
-      const process = spawn(this.binaryPath, args, {
+      const diarizeProcess = spawn(this.binaryPath, args, {
         env: {
           ...process.env,
           // Set library paths for finding ONNX Runtime
@@ -101,22 +108,22 @@ class DiarizationService {
           DYLD_FALLBACK_LIBRARY_PATH: path.dirname(this.binaryPath)
         }
       });
-      
+
       let output = '';
       let error = '';
 
-      process.stdout.on('data', (data) => {
+      diarizeProcess.stdout.on('data', (data) => {
         output += data.toString();
       });
 
-      process.stderr.on('data', (data) => {
+      diarizeProcess.stderr.on('data', (data) => {
         error += data.toString();
         if (verbose) {
           console.log('Diarization:', data.toString());
         }
       });
 
-      process.on('close', (code) => {
+      diarizeProcess.on('close', (code) => {
         if (code === 0) {
           try {
             const result = JSON.parse(output);
@@ -130,7 +137,7 @@ class DiarizationService {
         }
       });
 
-      process.on('error', (err) => {
+      diarizeProcess.on('error', (err) => {
         reject(new Error(`Failed to start diarization process: ${err.message}`));
       });
     });
@@ -1,7 +1,14 @@
 const fs = require('fs').promises;
+const { createWriteStream } = require('fs');
 const path = require('path');
 const { clipboard } = require('electron');
 
+// NEW: Streaming export tuning - segments written per event-loop turn.
+// Multi-hour diarized transcripts run to tens of thousands of segments;
+// batching keeps memory constant while yielding between batches keeps the
+// main process responsive during the export.
+const STREAM_BATCH_SIZE = 500;
+
 class ExportService {
   constructor() {
     this.supportedFormats = {
@@ -432,6 +439,183 @@ class ExportService {
     return csv;
   }
 
+  // NEW: Streaming export - writes segments incrementally to disk instead of
+  // building the whole document in memory first. Formats with per-segment
+  // bodies (txt, csv, srt, vtt, json) stream at constant memory; anything
+  // else falls back to the in-memory generators and a single write.
+  async exportToFile(transcriptionData, format, filePath, options = {}) {
+    const normalizedFormat = format.toLowerCase();
+
+    if (!this.canStreamFormat(normalizedFormat)) {
+      const result = this.supportedFormats.subtitle.includes(normalizedFormat)
+        ? await this.exportSubtitle(transcriptionData, normalizedFormat, options)
+        : await this.exportText(transcriptionData, normalizedFormat, options);
+      if (!result.success) {
+        return result;
+      }
+      return this.saveToFile(result.content, filePath);
+    }
+
+    const segments = transcriptionData.segments || [];
+    let stream = null;
+
+    try {
+      stream = createWriteStream(filePath, { encoding: 'utf8' });
+
+      await this.writeChunk(stream, this.streamHeader(normalizedFormat, transcriptionData, options));
+
+      for (let i = 0; i < segments.length; i += STREAM_BATCH_SIZE) {
+        let batch = '';
+        const end = Math.min(i + STREAM_BATCH_SIZE, segments.length);
+        for (let j = i; j < end; j++) {
+          batch += this.streamSegmentLine(normalizedFormat, segments[j], j, options);
+        }
+        await this.writeChunk(stream, batch);
+
+        // Yield between batches so progress events and UI IPC stay live
+        await new Promise(resolve => setImmediate(resolve));
+      }
+
+      await this.writeChunk(stream, this.streamFooter(normalizedFormat));
+
+      await new Promise((resolve, reject) => {
+        stream.end((error) => (error ? reject(error) : resolve()));
+      });
+
+      return {
+        success: true,
+        filePath,
+        segmentCount: segments.length,
+        mimeType: this.getMimeType(normalizedFormat)
+      };
+    } catch (error) {
+      if (stream) {
+        stream.destroy();
+      }
+      return { success: false, error: error.message };
+    }
+  }
+
+  canStreamFormat(format) {
+    return ['txt', 'csv', 'srt', 'vtt', 'json'].includes(format);
+  }
+
+  // Respect backpressure: when the OS buffer is full, wait for drain instead
+  // of queueing unbounded chunks in memory
+  writeChunk(stream, chunk) {
+    if (!chunk) {
+      return Promise.resolve();
+    }
+    return new Promise((resolve, reject) => {
+      stream.once('error', reject);
+      if (stream.write(chunk)) {
+        stream.removeListener('error', reject);
+        resolve();
+      } else {
+        stream.once('drain', () => {
+          stream.removeListener('error', reject);
+          resolve();
+        });
+      }
+    });
+  }
+
+  streamHeader(format, data, options) {
+    switch (format) {
+      case 'vtt':
+        return 'WEBVTT\n\n';
+      case 'csv': {
+        const headers = ['Start', 'End', 'Duration'];
+        if (options.includeSpeakers !== false) headers.push('Speaker');
+        headers.push('Text');
+        if (options.includeConfidence) headers.push('Confidence');
+        return headers.join(',') + '\n';
+      }
+      case 'json': {
+        // Everything except the segment array fits in one small object; the
+        // segments stream in afterwards one element at a time
+        const { segments, ...rest } = data;
+        const head = JSON.stringify({
+          ...rest,
+          exportedAt: new Date().toISOString(),
+          exportOptions: options
+        });
+        return head === '{}'
+          ? '{"segments":['
+          : head.slice(0, -1) + ',"segments":[';
+      }
+      case 'txt': {
+        let text = '';
+        if (data.title) {
+          text += `${data.title}\n${'='.repeat(data.title.length)}\n\n`;
+        }
+        if (data.metadata) {
+          text += `Generated: ${new Date(data.metadata.createdAt).toLocaleString()}\n`;
+          text += `Duration: ${this.formatDuration(data.metadata.duration)}\n`;
+          if (data.metadata.model) {
+            text += `Model: ${data.metadata.model}\n`;
+          }
+          text += '\n';
+        }
+        return text;
+      }
+      default:
+        return '';
+    }
+  }
+
+  streamSegmentLine(format, segment, index, options) {
+    switch (format) {
+      case 'srt': {
+        let text = segment.text;
+        if (segment.speaker && options.includeSpeakers !== false) {
+          text = `${segment.speaker}: ${text}`;
+        }
+        return `${index + 1}\n${this.formatSRTTimestamp(segment.start)} --> ${this.formatSRTTimestamp(segment.end)}\n${text}\n\n`;
+      }
+      case 'vtt': {
+        let text = segment.text;
+        if (segment.speaker && options.includeSpeakers !== false) {
+          text = `<v ${segment.speaker}>${text}`;
+        }
+        return `${index + 1}\n${this.formatVTTTimestamp(segment.start)} --> ${this.formatVTTTimestamp(segment.end)}\n${text}\n\n`;
+      }
+      case 'csv': {
+        const row = [segment.start, segment.end, segment.end - segment.start];
+        if (options.includeSpeakers !== false) {
+          row.push(segment.speaker || '');
+        }
+        row.push(`"${segment.text.replace(/"/g, '""')}"`);
+        if (options.includeConfidence) {
+          row.push(segment.confidence || '');
+        }
+        return row.join(',') + '\n';
+      }
+      case 'json':
+        return (index > 0 ? ',' : '') + JSON.stringify(segment);
+      case 'txt': {
+        let line = '';
+        if (options.includeTimestamps) {
+          line += `[${this.formatTimestamp(segment.start)} --> ${this.formatTimestamp(segment.end)}] `;
+        }
+        if (options.includeSpeakers !== false && segment.speaker) {
+          line += `${segment.speaker}: `;
+        }
+        line += segment.text;
+        if (options.includeConfidence && segment.confidence) {
+          line += ` (${Math.round(segment.confidence * 100)}%)`;
+        }
+        return line + '\n';
+      }
+      default:
+        return '';
+    }
+  }
+
+  streamFooter(format) {
+    return format === 'json' ? ']}' : '';
+  }
+
   async copyToClipboard(text) {
     try {
       clipboard.writeText(text);
@@ -0,0 +1,222 @@
+// src/main/services/live-transcription-engine.js - Streaming microphone transcription
+// Wraps the whisper-stream binary (sliding-window incremental decoder from
+// whisper.cpp) so live captions appear within a second or two of speech.
+
+const { EventEmitter } = require('events');
+const { spawn } = require('child_process');
+const path = require('path');
+const os = require('os');
+
+// Sliding-window decoder tuning: decode every 800 ms over a 6 s window,
+// keeping 200 ms of context so words are not clipped at window boundaries
+const STREAM_STEP_MS = 800;
+const STREAM_LENGTH_MS = 6000;
+const STREAM_KEEP_MS = 200;
+
+class LiveTranscriptionEngine extends EventEmitter {
+  constructor(modelManager, binaryManager) {
+    super();
+    this.modelManager = modelManager;
+    this.binaryManager = binaryManager;
+    this.platform = os.platform();
+    this.process = null;
+    this.sessionId = null;
+    this.segmentCounter = 0;
+    this.sessionStartTime = null;
+  }
+
+  getStreamBinaryPath() {
+    const executableName = this.platform === 'win32' ? 'whisper-stream.exe' : 'whisper-stream';
+    return path.join(this.binaryManager.binariesDir, executableName);
+  }
+
+  async isAvailable() {
+    try {
+      const fs = require('fs').promises;
+      await fs.access(this.getStreamBinaryPath());
+      return true;
+    } catch (error) {
+      return false;
+    }
+  }
+
+  isRunning() {
+    return this.process !== null && this.process.exitCode === null;
+  }
+
+  /**
+   * Start live transcription from the microphone. Partial text is emitted as
+   * 'partial' events while a window is still being refined, and 'segment'
+   * events once a window is committed.
+   */
+  async start(options = {}) {
+    if (this.isRunning()) {
+      throw new Error('Live transcription is already running');
+    }
+
+    if (!(await this.isAvailable())) {
+      throw new Error('whisper-stream binary not found. Run "npm run build:whisper" (requires SDL2 for microphone capture).');
+    }
+
+    const modelPath = await this.modelManager.getCompatibleModelPath(options.model || 'whisper-tiny');
+    const binaryPath = this.getStreamBinaryPath();
+
+    this.sessionId = options.sessionId || `live_${Date.now()}_${Math.random().toString(36).substr(2, 9)}`;
+    this.segmentCounter = 0;
+    this.sessionStartTime = Date.now();
+
+    const args = [
+      '--model', modelPath,
+      '--step', STREAM_STEP_MS.toString(),
+      '--length', STREAM_LENGTH_MS.toString(),
+      '--keep', STREAM_KEEP_MS.toString(),
+      '--threads', Math.min(4, os.cpus().length).toString()
+    ];
+
+    if (options.language && options.language !== 'auto') {
+      args.push('--language', options.language);
+    }
+
+    if (options.captureDeviceId !== undefined) {
+      args.push('--capture', options.captureDeviceId.toString());
+    }
+
+    console.log(`🎙️ Starting live transcription: ${this.sessionId}`);
+    console.log(`📋 whisper-stream args: ${args.join(' ')}`);
+
+    const spawnOptions = {
+      stdio: ['ignore', 'pipe', 'pipe'],
+      env: { ...process.env }
+    };
+
+    if (this.platform === 'win32') {
+      spawnOptions.cwd = path.dirname(binaryPath);
+    }
+
+    const streamProcess = spawn(binaryPath, args, spawnOptions);
+    this.process = streamProcess;
+
+    let lineBuffer = '';
+
+    streamProcess.stdout.on('data', (data) => {
+      lineBuffer += data.toString();
+      const lines = lineBuffer.split('\n');
+      lineBuffer = lines.pop(); // Keep incomplete trailing line in the buffer
+
+      for (const line of lines) {
+        this.handleStreamLine(line);
+      }
+    });
+
+    streamProcess.stderr.on('data', (data) => {
+      const output = data.toString().trim();
+      if (output) {
+        console.log(`📝 whisper-stream: ${output}`);
+      }
+    });
+
+    streamProcess.on('close', (code) => {
+      if (this.process === streamProcess) {
+        console.log(`🏁 Live transcription ended with code: ${code}`);
+        const sessionId = this.sessionId;
+        this.process = null;
+        this.sessionId = null;
+        this.emit('liveStopped', { sessionId, code });
+      }
+    });
+
+    streamProcess.on('error', (error) => {
+      console.error(`❌ whisper-stream failed to start: ${error.message}`);
+      this.emit('error', { transcriptionId: this.sessionId, error: error.message });
+    });
+
+    this.emit('liveStarted', { sessionId: this.sessionId, model: options.model || 'whisper-tiny' });
+    return { sessionId: this.sessionId };
+  }
+
+  /**
+   * whisper-stream rewrites the current window as it refines, then prints a
+   * committed line when the window slides. Timestamped lines are committed
+   * segments; bare text lines are in-flight partials.
+   */
+  handleStreamLine(rawLine) {
+    // Strip ANSI cursor-control sequences whisper-stream uses to redraw
+    // lines. The escape byte is written as \x1b, not a raw control char,
+    // so the anchor is visible in editors and cannot be silently lost -
+    // an unanchored pattern would eat literal bracketed text like
+    // [BLANK_AUDIO] and break the blank-audio filters below. Any bare
+    // escape byte left from a truncated sequence is dropped too.
+    const line = rawLine.replace(/\x1b\[[0-9;]*[A-Za-z]/g, '').replace(/\x1b/g, '').trim();
+    if (!line) return;
+
+    // Skip the init/banner output
+    if (line.startsWith('init:') || line.startsWith('main:') || line.startsWith('whisper_')) {
+      return;
+    }
+
+    const timestamped = line.match(/\[(\d{2}:\d{2}:\d{2}\.\d{3})\s*-->\s*(\d{2}:\d{2}:\d{2}\.\d{3})\]\s*(.+)/);
+
+    if (timestamped) {
+      const [, startTime, endTime, text] = timestamped;
+      const segment = {
+        id: this.segmentCounter++,
+        start: this.parseTimeToSeconds(startTime),
+        end: this.parseTimeToSeconds(endTime),
+        text: text.trim(),
+        final: true
+      };
+
+      if (segment.text && segment.text !== '[BLANK_AUDIO]') {
+        this.emit('segment', { transcriptionId: this.sessionId, segment });
+      }
+    } else if (line !== '[BLANK_AUDIO]') {
+      this.emit('partial', {
+        transcriptionId: this.sessionId,
+        text: line,
+        elapsedMs: Date.now() - this.sessionStartTime
+      });
+    }
+  }
+
+  parseTimeToSeconds(timeStr) {
+    const parts = timeStr.split(':');
+    const secondsParts = parts[2].split('.');
+    return parseInt(parts[0]) * 3600 + parseInt(parts[1]) * 60 +
+           parseInt(secondsParts[0]) + parseInt(secondsParts[1] || 0) / 1000;
+  }
+
+  async stop() {
+    if (!this.isRunning()) {
+      return { success: true };
+    }
+
+    const streamProcess = this.process;
+
+    await new Promise((resolve) => {
+      const forceKill = setTimeout(() => {
+        streamProcess.kill('SIGKILL');
+        resolve();
+      }, 3000);
+
+      streamProcess.once('close', () => {
+        clearTimeout(forceKill);
+        resolve();
+      });
+
+      streamProcess.kill('SIGTERM');
+    });
+
+    console.log('🛑 Live transcription stopped');
+    return { success: true };
+  }
+
+  getStatus() {
+    return {
+      running: this.isRunning(),
+      sessionId: this.sessionId,
+      streamBinaryPath: this.getStreamBinaryPath()
+    };
+  }
+}
+
+module.exports = LiveTranscriptionEngine;
@@ -9,7 +9,8 @@ const crypto = require('crypto');
 const { spawn } = require('child_process');
 
 // Import model configurations from separate file
-const { WHISPER_MODELS, MODEL_NAME_MAPPING, CONFIG } = require('./models-config');
+const { WHISPER_MODELS, MODEL_NAME_MAPPING, QUANTIZATION_TYPES, CONFIG } = require('./models-config');
+const modelResidency = require('./model-residency');
 
 class ModelManager extends EventEmitter {
   constructor() {
@@ -26,6 +27,9 @@ class ModelManager extends EventEmitter {
     
     // Use imported model name mapping
     this.modelNameMapping = MODEL_NAME_MAPPING;
+
+    // NEW: Lazy binary manager handle for locating the quantize tool
+    this.binaryManager = null;
   }
 
   getModelsDirectory() {
@@ -104,7 +108,17 @@ class ModelManager extends EventEmitter {
             type: availableModel?.type || 'unknown',
             isCompatible: this.isFileNameCompatible(file)
           };
-          
+
+          // NEW: Note whether the CoreML encoder bundle sits next to the model
+          if (process.platform === 'darwin') {
+            try {
+              await fs.access(path.join(this.modelsDir, this.getCoreMLEncoderDirName(file)));
+              installedModel.coremlEncoder = true;
+            } catch {
+              installedModel.coremlEncoder = false;
+            }
+          }
+
           this.installedModels.set(modelId, installedModel);
         }
       }
@@ -198,6 +212,9 @@ class ModelManager extends EventEmitter {
     if (installedModel) {
       // If the installed model is already compatible, return its path
       if (installedModel.isCompatible) {
+        if (modelResidency.isResident(installedModel.path)) {
+          console.log(`📌 Model already resident in memory - concurrent jobs share one copy`);
+        }
         console.log(`✅ Found compatible model: ${installedModel.path}`);
         return installedModel.path;
       }
@@ -246,7 +263,14 @@ class ModelManager extends EventEmitter {
   getModelIdFromFilename(filename) {
     // Extract model ID from filename
     const baseName = path.basename(filename, path.extname(filename));
-    
+
+    // NEW: Quantized files (ggml-medium-q5_0.bin) map to '<base-id>-<type>'
+    const quantMatch = baseName.match(/^(ggml-)?(.+)-(q\d_\d)$/);
+    if (quantMatch) {
+      const baseId = this.getModelIdFromFilename(`${quantMatch[2]}.bin`);
+      return `${baseId}-${quantMatch[3]}`;
+    }
+
     // Handle GGML model files (ggml-tiny.bin, ggml-base.bin, etc.)
     const ggmlMap = {
       'ggml-tiny': 'whisper-tiny',
@@ -254,7 +278,8 @@ class ModelManager extends EventEmitter {
       'ggml-small': 'whisper-small',
       'ggml-medium': 'whisper-medium',
       'ggml-large-v2': 'whisper-large-v2',
-      'ggml-large-v3': 'whisper-large-v3'
+      'ggml-large-v3': 'whisper-large-v3',
+      'ggml-small.en-tdrz': 'whisper-small.en-tdrz'
     };
     
     // Map common filenames to model IDs
@@ -270,7 +295,9 @@ class ModelManager extends EventEmitter {
       'whisper-small': 'whisper-small',
       'whisper-medium': 'whisper-medium',
       'whisper-large-v2': 'whisper-large-v2',
-      'whisper-large-v3': 'whisper-large-v3'
+      'whisper-large-v3': 'whisper-large-v3',
+      'small.en-tdrz': 'whisper-small.en-tdrz',
+      'whisper-small.en-tdrz': 'whisper-small.en-tdrz'
     };
     
     return ggmlMap[baseName] || filenameMap[baseName] || baseName;
@@ -287,20 +314,31 @@ class ModelManager extends EventEmitter {
   }
 
   async getInstalledModels() {
-    return Array.from(this.installedModels.values());
+    // NEW: Report whether the model is currently resident in memory (shared
+    // across concurrent jobs by the addon engine cache / daemon)
+    return Array.from(this.installedModels.values()).map(model => ({
+      ...model,
+      residentInMemory: modelResidency.isResident(model.path)
+    }));
   }
 
   async getModelInfo(modelId) {
     const available = this.availableModels.get(modelId);
     const installed = this.installedModels.get(modelId);
-    
+
     return {
       ...available,
       isInstalled: !!installed,
-      installedInfo: installed
+      installedInfo: installed,
+      residentInMemory: installed ? modelResidency.isResident(installed.path) : false
     };
   }
 
+  // NEW: Which model files are loaded right now, and by what
+  getResidentModels() {
+    return modelResidency.list();
+  }
+
   // FIXED: Enhanced download method with better duplicate handling and progress tracking
   async downloadModel(modelId) {
     const model = this.availableModels.get(modelId);
@@ -389,7 +427,7 @@ class ModelManager extends EventEmitter {
       
       console.log(`📥 Downloading ${model.name} as ${outputFilename}`);
       
-      await this.downloadFile(model.downloadUrl, outputPath, downloadInfo);
+      await this.downloadFileSegmented(model.downloadUrl, outputPath, downloadInfo);
 
       if (downloadInfo.cancelled) {
         try { await fs.unlink(outputPath); } catch {}
@@ -397,10 +435,11 @@ class ModelManager extends EventEmitter {
         this.downloadStates.delete(modelId); // FIXED: Clean up download state
         this.emit('downloadCancelled', { modelId });
       } else {
-        // Skip checksum verification for now since we're using new model files
-        // if (downloadInfo.model.checksum) {
-        //   await this.verifyChecksum(outputPath, downloadInfo.model.checksum);
-        // }
+        // Verify checksum when the catalog provides one (locally quantized
+        // models have none)
+        if (downloadInfo.model.checksum) {
+          await this.verifyChecksum(outputPath, downloadInfo.model.checksum);
+        }
 
         const stats = await fs.stat(outputPath);
         const installedModel = {
@@ -415,6 +454,13 @@ class ModelManager extends EventEmitter {
           isCompatible: this.isFileNameCompatible(outputFilename)
         };
 
+        // NEW: CoreML encoder bundle (macOS). Best-effort - the CoreML build
+        // of whisper-cli falls back to the Metal/CPU encoder when no bundle
+        // sits next to the GGML file, so a failed fetch only costs speed
+        if (process.platform === 'darwin') {
+          installedModel.coremlEncoder = await this.downloadCoreMLEncoder(modelId, outputFilename);
+        }
+
         // FIXED: Add to installed models BEFORE emitting events
         this.installedModels.set(modelId, installedModel);
 
@@ -575,6 +621,246 @@ class ModelManager extends EventEmitter {
     });
   }
 
+  // NEW: Multi-connection resumable download. Probes the final URL for HTTP
+  // range support, fetches DOWNLOAD_SEGMENTS byte ranges concurrently into
+  // .partN files next to the destination, and resumes any partial segments an
+  // interrupted run left on disk before assembling the final file. Falls back
+  // to the single-stream downloadFile() for small files or servers without
+  // range support.
+  async downloadFileSegmented(url, outputPath, downloadInfo) {
+    let probe = null;
+    try {
+      probe = await this.probeRangeSupport(url);
+    } catch (error) {
+      console.warn(`⚠️ Range probe failed (${error.message}) - using single-stream download`);
+    }
+
+    if (!probe || !probe.acceptRanges || !probe.totalBytes ||
+        probe.totalBytes < CONFIG.SEGMENTED_DOWNLOAD_MIN_BYTES) {
+      return this.downloadFile(url, outputPath, downloadInfo);
+    }
+
+    const { finalUrl, totalBytes } = probe;
+    downloadInfo.totalBytes = totalBytes;
+    if (this.downloadStates.has(downloadInfo.modelId)) {
+      this.downloadStates.get(downloadInfo.modelId).totalBytes = totalBytes;
+    }
+
+    // Plan the byte ranges ([start, end] inclusive) and their part files
+    const segmentSize = Math.ceil(totalBytes / CONFIG.DOWNLOAD_SEGMENTS);
+    const segments = [];
+    for (let i = 0; i < CONFIG.DOWNLOAD_SEGMENTS; i++) {
+      const start = i * segmentSize;
+      const end = Math.min(totalBytes - 1, start + segmentSize - 1);
+      if (start > end) break;
+      segments.push({ index: i, start, end, have: 0, partPath: `${outputPath}.part${i}` });
+    }
+
+    // Resume from whatever a previous interrupted run already fetched
+    let resumedBytes = 0;
+    for (const segment of segments) {
+      try {
+        const stat = await fs.stat(segment.partPath);
+        const span = segment.end - segment.start + 1;
+        segment.have = stat.size <= span ? stat.size : 0; // Oversized part = corrupt, refetch
+      } catch (error) {
+        segment.have = 0;
+      }
+      resumedBytes += segment.have;
+    }
+    if (resumedBytes > 0) {
+      console.log(`🔄 Resuming ${downloadInfo.modelId}: ${Math.round(resumedBytes / 1024 / 1024)}MB already on disk`);
+    }
+
+    // Aggregate progress across connections, throttled like the single-stream path
+    let downloadedBytes = resumedBytes;
+    let lastProgressEmit = 0;
+    const onChunk = (length) => {
+      downloadedBytes += length;
+      downloadInfo.downloadedBytes = downloadedBytes;
+      downloadInfo.progress = (downloadedBytes / totalBytes) * 100;
+
+      if (this.downloadStates.has(downloadInfo.modelId)) {
+        Object.assign(this.downloadStates.get(downloadInfo.modelId), {
+          downloadedBytes,
+          progress: downloadInfo.progress
+        });
+      }
+
+      const now = Date.now();
+      const progressChanged = Math.floor(downloadInfo.progress) > Math.floor(lastProgressEmit);
+      if (progressChanged || now - (this.lastEmitTime || 0) > CONFIG.PROGRESS_EMIT_INTERVAL) {
+        this.lastEmitTime = now;
+        lastProgressEmit = downloadInfo.progress;
+        console.log(`📊 Download progress ${downloadInfo.modelId}: ${Math.round(downloadInfo.progress)}% (${Math.round(downloadedBytes / 1024 / 1024)}MB/${Math.round(totalBytes / 1024 / 1024)}MB, ${segments.length} connections)`);
+        this.emit('downloadProgress', {
+          modelId: downloadInfo.modelId,
+          progress: downloadInfo.progress,
+          downloadedBytes,
+          totalBytes,
+          speed: this.calculateDownloadSpeed(downloadInfo)
+        });
+      }
+    };
+
+    downloadInfo.segmentRequests = [];
+    try {
+      await Promise.all(segments.map(segment =>
+        this.downloadSegment(finalUrl, segment, downloadInfo, onChunk)));
+    } catch (error) {
+      if (downloadInfo.cancelled || error.message === 'Download cancelled') {
+        await this.cleanupPartFiles(segments);
+        throw new Error('Download cancelled');
+      }
+      // Keep the part files - the next attempt resumes from them
+      console.warn(`⚠️ Segmented download interrupted (${error.message}) - partial segments kept for resume`);
+      throw error;
+    } finally {
+      downloadInfo.segmentRequests = null;
+    }
+
+    // Assemble the part files onto the destination in order
+    const writeStream = require('fs').createWriteStream(outputPath);
+    try {
+      for (const segment of segments) {
+        await new Promise((resolve, reject) => {
+          const readStream = require('fs').createReadStream(segment.partPath);
+          readStream.on('error', reject);
+          readStream.on('end', resolve);
+          readStream.pipe(writeStream, { end: false });
+        });
+      }
+    } finally {
+      await new Promise(resolve => writeStream.end(resolve));
+    }
+    await this.cleanupPartFiles(segments);
+
+    console.log(`✅ Download completed for ${downloadInfo.modelId}: ${Math.round(downloadedBytes / 1024 / 1024)}MB over ${segments.length} connections`);
+    this.emit('downloadProgress', {
+      modelId: downloadInfo.modelId,
+      progress: 100,
+      downloadedBytes,
+      totalBytes,
+      speed: this.calculateDownloadSpeed(downloadInfo)
+    });
+  }
+
+  // NEW: Resolve redirects and ask the server whether it honors byte ranges
+  // (a 1-byte ranged GET; the Content-Range total also gives us the size)
+  async probeRangeSupport(url, redirectCount = 0) {
+    if (redirectCount > 5) {
+      throw new Error('Too many redirects');
+    }
+
+    return new Promise((resolve, reject) => {
+      const protocol = url.startsWith('https:') ? https : http;
+      const request = protocol.get(url, { headers: { Range: 'bytes=0-0' } }, (response) => {
+        response.resume(); // Discard the probe byte
+
+        if (response.statusCode === 301 || response.statusCode === 302) {
+          request.destroy();
+          return this.probeRangeSupport(response.headers.location, redirectCount + 1)
+            .then(resolve)
+            .catch(reject);
+        }
+
+        if (response.statusCode === 206) {
+          const contentRange = response.headers['content-range'] || '';
+          const totalMatch = contentRange.match(/\/(\d+)\s*$/);
+          request.destroy();
+          resolve({
+            finalUrl: url,
+            acceptRanges: true,
+            totalBytes: totalMatch ? parseInt(totalMatch[1], 10) : 0
+          });
+        } else if (response.statusCode === 200) {
+          // Server ignored the range header - single stream only
+          request.destroy();
+          resolve({
+            finalUrl: url,
+            acceptRanges: false,
+            totalBytes: parseInt(response.headers['content-length'], 10) || 0
+          });
+        } else {
+          request.destroy();
+          reject(new Error(`HTTP ${response.statusCode}: ${response.statusMessage}`));
+        }
+      });
+
+      request.on('error', reject);
+      request.setTimeout(CONFIG.DOWNLOAD_TIMEOUT, () => {
+        request.destroy();
+        reject(new Error('Range probe timeout'));
+      });
+    });
+  }
+
+  // NEW: Stream one byte range into its part file, appending to whatever a
+  // previous run already fetched
+  downloadSegment(url, segment, downloadInfo, onChunk) {
+    const resumeFrom = segment.start + segment.have;
+    if (resumeFrom > segment.end) {
+      return Promise.resolve(); // Segment finished in a previous run
+    }
+
+    return new Promise((resolve, reject) => {
+      const protocol = url.startsWith('https:') ? https : http;
+      const request = protocol.get(url, {
+        headers: { Range: `bytes=${resumeFrom}-${segment.end}` }
+      }, (response) => {
+        if (response.statusCode !== 206) {
+          response.resume();
+          reject(new Error(`Expected HTTP 206 for ranged request, got ${response.statusCode}`));
+          return;
+        }
+
+        const writeStream = require('fs').createWriteStream(segment.partPath, {
+          flags: segment.have > 0 ? 'a' : 'w'
+        });
+
+        response.on('data', (chunk) => {
+          if (downloadInfo.cancelled) {
+            request.destroy(new Error('Download cancelled'));
+            return;
+          }
+          onChunk(chunk.length);
+        });
+
+        response.on('error', (error) => {
+          writeStream.destroy();
+          reject(error);
+        });
+        writeStream.on('error', (error) => {
+          request.destroy();
+          reject(error);
+        });
+        writeStream.on('finish', resolve);
+
+        response.pipe(writeStream);
+      });
+
+      if (downloadInfo.segmentRequests) {
+        downloadInfo.segmentRequests.push(request);
+      }
+
+      request.on('error', reject);
+      request.setTimeout(CONFIG.DOWNLOAD_TIMEOUT, () => {
+        request.destroy();
+        reject(new Error('Download timeout'));
+      });
+    });
+  }
+
+  async cleanupPartFiles(segments) {
+    for (const segment of segments) {
+      try {
+        await fs.unlink(segment.partPath);
+      } catch (error) {
+        // Part already gone
+      }
+    }
+  }
+
   calculateDownloadSpeed(downloadInfo) {
     const elapsed = (Date.now() - downloadInfo.startTime) / 1000;
     return elapsed > 0 ? downloadInfo.downloadedBytes / elapsed : 0;
@@ -633,8 +919,16 @@ class ModelManager extends EventEmitter {
         }
       }
       
+      // NEW: Remove the CoreML encoder bundle along with its model
+      const encoderDir = path.join(this.modelsDir, this.getCoreMLEncoderDirName(installedModel.filename));
+      try {
+        await fs.rm(encoderDir, { recursive: true, force: true });
+      } catch (error) {
+        // Bundle was never downloaded, that's okay
+      }
+
       this.installedModels.delete(modelId);
-      
+
       this.emit('modelDeleted', { modelId });
       return { success: true };
     } catch (error) {
@@ -689,6 +983,11 @@ class ModelManager extends EventEmitter {
       if (downloadInfo.request) {
         downloadInfo.request.destroy(new Error('Download cancelled'));
       }
+      if (downloadInfo.segmentRequests) {
+        for (const request of downloadInfo.segmentRequests) {
+          request.destroy(new Error('Download cancelled'));
+        }
+      }
       if (downloadInfo.writeStream) {
         downloadInfo.writeStream.destroy();
       }
@@ -725,6 +1024,185 @@ class ModelManager extends EventEmitter {
     return this.installedModels.has(modelId);
   }
 
+  // NEW: Path to the whisper.cpp quantize tool staged next to whisper-cli
+  // NEW: CoreML encoder bundles (macOS). whisper-cli looks for
+  // ggml-<model>-encoder.mlmodelc next to the GGML file and runs the encoder
+  // on the Apple Neural Engine when the bundle is present.
+  getCoreMLEncoderDirName(outputFilename) {
+    return outputFilename.replace(/\.bin$/, '') + '-encoder.mlmodelc';
+  }
+
+  // Upstream only publishes encoder bundles for the unquantized models; a
+  // quantized variant shares its base model's encoder, so the base bundle is
+  // fetched and installed under the variant's name
+  getCoreMLUpstreamDirName(outputFilename) {
+    return outputFilename.replace(/-q\d_\d\.bin$/, '.bin').replace(/\.bin$/, '') + '-encoder.mlmodelc';
+  }
+
+  async hasCoreMLEncoder(modelId) {
+    const installedModel = this.installedModels.get(modelId);
+    if (!installedModel) return false;
+    try {
+      await fs.access(path.join(this.modelsDir, this.getCoreMLEncoderDirName(installedModel.filename)));
+      return true;
+    } catch {
+      return false;
+    }
+  }
+
+  // Fetch and unpack the .mlmodelc bundle for an installed model. Returns
+  // whether the bundle is in place; failures are logged, not thrown - the
+  // encoder transparently falls back without it.
+  async downloadCoreMLEncoder(modelId, outputFilename) {
+    const encoderDirName = this.getCoreMLEncoderDirName(outputFilename);
+    const encoderDir = path.join(this.modelsDir, encoderDirName);
+    const zipPath = `${encoderDir}.zip`;
+
+    try {
+      // Already unpacked (e.g. re-download of the GGML file)
+      try {
+        await fs.access(encoderDir);
+        return true;
+      } catch { /* not yet installed */ }
+
+      const upstreamDirName = this.getCoreMLUpstreamDirName(outputFilename);
+      const url = `${CONFIG.COREML_ENCODER_BASE_URL}/${upstreamDirName}.zip`;
+
+      console.log(`📥 Fetching CoreML encoder bundle: ${upstreamDirName}.zip`);
+      await this.downloadFile(url, zipPath, { modelId: `${modelId}-coreml` });
+
+      // .mlmodelc is a directory bundle; ditto ships with macOS and keeps
+      // the structure intact
+      await new Promise((resolve, reject) => {
+        const ditto = spawn('ditto', ['-xk', zipPath, this.modelsDir]);
+        let stderr = '';
+        ditto.stderr.on('data', (data) => { stderr += data.toString(); });
+        ditto.on('close', (code) => {
+          code === 0 ? resolve() : reject(new Error(`ditto exited with code ${code}: ${stderr}`));
+        });
+        ditto.on('error', (error) => reject(error));
+      });
+
+      // Quantized variants: the zip unpacks under the base model's name
+      if (upstreamDirName !== encoderDirName) {
+        await fs.rename(path.join(this.modelsDir, upstreamDirName), encoderDir);
+      }
+
+      await fs.access(encoderDir);
+      console.log(`✅ CoreML encoder installed: ${encoderDirName}`);
+      return true;
+    } catch (error) {
+      console.log(`💡 No CoreML encoder for ${modelId} (${error.message}) - encoder falls back to Metal/CPU`);
+      return false;
+    } finally {
+      try { await fs.unlink(zipPath); } catch { /* zip already gone */ }
+    }
+  }
+
+  getQuantizeBinaryPath() {
+    if (!this.binaryManager) {
+      const BinaryManagerDLL = require('./binary-manager-dll');
+      this.binaryManager = new BinaryManagerDLL();
+    }
+    const executable = process.platform === 'win32' ? 'quantize.exe' : 'quantize';
+    return path.join(this.binaryManager.binariesDir, executable);
+  }
+
+  // NEW: Check whether local quantization is possible (tool built and staged)
+  async isQuantizationAvailable() {
+    try {
+      await fs.access(this.getQuantizeBinaryPath());
+      return true;
+    } catch (error) {
+      return false;
+    }
+  }
+
+  // NEW: Quantize an installed full-precision model locally with the bundled
+  // whisper.cpp quantize tool - roughly halves resident memory at q5_0/q8_0
+  // without another multi-GB download
+  async quantizeModel(modelId, quantType = 'q5_0') {
+    if (!QUANTIZATION_TYPES.includes(quantType)) {
+      throw new Error(`Unsupported quantization type: ${quantType}. Supported: ${QUANTIZATION_TYPES.join(', ')}`);
+    }
+
+    const sourceModel = this.installedModels.get(modelId);
+    if (!sourceModel) {
+      throw new Error(`Model ${modelId} is not installed`);
+    }
+    if (sourceModel.id.match(/-q\d_\d$/)) {
+      throw new Error(`Model ${modelId} is already quantized`);
+    }
+
+    const quantizedId = `${modelId}-${quantType}`;
+    if (this.installedModels.has(quantizedId)) {
+      throw new Error(`Quantized model ${quantizedId} already exists`);
+    }
+
+    const quantizeBinary = this.getQuantizeBinaryPath();
+    try {
+      await fs.access(quantizeBinary);
+    } catch (error) {
+      throw new Error('Quantize tool not found. Run: npm run build:whisper to build it');
+    }
+
+    // Always quantize from the whisper.cpp-compatible (ggml-) file
+    const sourcePath = await this.getCompatibleModelPath(modelId);
+    const sourceFilename = path.basename(sourcePath);
+    const outputFilename = sourceFilename.replace(/\.bin$/, `-${quantType}.bin`);
+    const outputPath = path.join(this.modelsDir, outputFilename);
+
+    console.log(`⚙️ Quantizing ${sourceFilename} -> ${outputFilename} (${quantType})`);
+    this.emit('quantizeStart', { modelId, quantizedId, quantType });
+
+    await new Promise((resolve, reject) => {
+      const quantizeProcess = spawn(quantizeBinary, [sourcePath, outputPath, quantType]);
+
+      let stderr = '';
+      quantizeProcess.stderr.on('data', (data) => {
+        stderr += data.toString();
+      });
+
+      quantizeProcess.on('close', (code) => {
+        if (code === 0) {
+          resolve();
+        } else {
+          reject(new Error(`Quantization failed with code ${code}: ${stderr.split('\n').slice(-5).join('\n')}`));
+        }
+      });
+
+      quantizeProcess.on('error', (error) => {
+        reject(new Error(`Failed to start quantize tool: ${error.message}`));
+      });
+    }).catch(async (error) => {
+      // Clean up a partial output file before surfacing the error
+      try { await fs.unlink(outputPath); } catch {}
+      this.emit('quantizeError', { modelId, quantizedId, error: error.message });
+      throw error;
+    });
+
+    const stats = await fs.stat(outputPath);
+    const availableModel = this.availableModels.get(quantizedId);
+    const installedModel = {
+      id: quantizedId,
+      name: availableModel?.name || `${sourceModel.name} (${quantType})`,
+      path: outputPath,
+      filename: outputFilename,
+      size: stats.size,
+      installedAt: new Date(),
+      version: sourceModel.version,
+      type: sourceModel.type,
+      isCompatible: this.isFileNameCompatible(outputFilename)
+    };
+
+    this.installedModels.set(quantizedId, installedModel);
+
+    console.log(`✅ Quantized ${modelId} to ${quantType}: ${(stats.size / 1024 / 1024).toFixed(0)} MB`);
+    this.emit('quantizeComplete', { modelId, quantizedId, quantType, installedModel });
+
+    return { success: true, installedModel };
+  }
+
   // NEW: Get model statistics including compatibility info
   async getModelStatistics() {
     const stats = {
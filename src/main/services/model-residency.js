@@ -0,0 +1,56 @@
+// src/main/services/model-residency.js
+// NEW: Process-wide registry of models currently resident in memory
+//
+// The in-process addon and the whisper-server daemon both keep model weights
+// loaded between jobs; concurrent transcriptions on the same model share one
+// loaded copy (each job gets its own decoding state over the shared context).
+// This registry is the single place that knows which model files are resident
+// and who is holding them, so the model manager can report cache residency
+// without a direct handle on the transcription provider.
+//
+// Exported as a singleton - every require() sees the same registry.
+
+class ModelResidencyRegistry {
+  constructor() {
+    // modelPath -> { holders: Set<string>, since: Date }
+    this.residents = new Map();
+  }
+
+  // Record that a holder ('addon', 'daemon', ...) has this model loaded
+  acquire(modelPath, holder) {
+    let entry = this.residents.get(modelPath);
+    if (!entry) {
+      entry = { holders: new Set(), since: new Date() };
+      this.residents.set(modelPath, entry);
+    }
+    entry.holders.add(holder);
+    console.log(`📌 Model resident in memory (${holder}): ${modelPath}`);
+  }
+
+  // Release a holder's claim; the model drops out when nobody holds it
+  release(modelPath, holder) {
+    const entry = this.residents.get(modelPath);
+    if (!entry) return;
+
+    entry.holders.delete(holder);
+    if (entry.holders.size === 0) {
+      this.residents.delete(modelPath);
+      console.log(`📌 Model no longer resident: ${modelPath}`);
+    }
+  }
+
+  isResident(modelPath) {
+    return this.residents.has(modelPath);
+  }
+
+  // Residency snapshot for status reporting
+  list() {
+    return Array.from(this.residents.entries()).map(([modelPath, entry]) => ({
+      modelPath,
+      holders: Array.from(entry.holders),
+      since: entry.since
+    }));
+  }
+}
+
+module.exports = new ModelResidencyRegistry();
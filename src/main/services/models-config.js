@@ -121,9 +121,118 @@ const WHISPER_MODELS = [
     version: '3.0.0',
     type: 'whisper',
     expectedFilename: 'ggml-large-v3.bin'
+  },
+  {
+    id: 'whisper-small.en-tdrz',
+    name: 'Whisper Small English (TinyDiarize)',
+    provider: 'OpenAI',
+    size: '465 MB',
+    sizeBytes: 465000000,
+    languages: ['en'],
+    description: 'English small model with built-in speaker-turn detection - powers the fast two-speaker mode without a separate diarization pass',
+    accuracy: 'Very Good',
+    speed: 'Medium',
+    requirements: {
+      ram: '4 GB',
+      disk: '500 MB'
+    },
+    downloadUrl: 'https://huggingface.co/akashmjn/tinydiarize-whisper.cpp/resolve/main/ggml-small.en-tdrz.bin',
+    version: '1.0.0',
+    type: 'whisper',
+    expectedFilename: 'ggml-small.en-tdrz.bin'
+  },
+  // Quantized variants - pre-quantized by upstream whisper.cpp. Roughly half
+  // the RAM of the full-precision file with minimal accuracy loss; ideal for
+  // machines that swap on medium/large
+  {
+    id: 'whisper-small-q8_0',
+    name: 'Whisper Small (Quantized q8_0)',
+    provider: 'OpenAI',
+    size: '253 MB',
+    sizeBytes: 253000000,
+    languages: ['multilingual'],
+    description: 'Quantized small model - near-identical accuracy at roughly half the memory',
+    accuracy: 'Very Good',
+    speed: 'Medium-Fast',
+    requirements: {
+      ram: '2 GB',
+      disk: '300 MB'
+    },
+    downloadUrl: 'https://huggingface.co/ggerganov/whisper.cpp/resolve/main/ggml-small-q8_0.bin',
+    version: '1.0.0',
+    type: 'whisper',
+    quantization: 'q8_0',
+    baseModel: 'whisper-small',
+    expectedFilename: 'ggml-small-q8_0.bin'
+  },
+  {
+    id: 'whisper-medium-q5_0',
+    name: 'Whisper Medium (Quantized q5_0)',
+    provider: 'OpenAI',
+    size: '539 MB',
+    sizeBytes: 539000000,
+    languages: ['multilingual'],
+    description: 'Quantized medium model - high accuracy in about a third of the memory',
+    accuracy: 'Excellent',
+    speed: 'Medium',
+    requirements: {
+      ram: '3 GB',
+      disk: '600 MB'
+    },
+    downloadUrl: 'https://huggingface.co/ggerganov/whisper.cpp/resolve/main/ggml-medium-q5_0.bin',
+    version: '1.0.0',
+    type: 'whisper',
+    quantization: 'q5_0',
+    baseModel: 'whisper-medium',
+    expectedFilename: 'ggml-medium-q5_0.bin'
+  },
+  {
+    id: 'whisper-medium-q8_0',
+    name: 'Whisper Medium (Quantized q8_0)',
+    provider: 'OpenAI',
+    size: '785 MB',
+    sizeBytes: 785000000,
+    languages: ['multilingual'],
+    description: 'Quantized medium model - near-identical accuracy at roughly half the memory',
+    accuracy: 'Excellent',
+    speed: 'Medium',
+    requirements: {
+      ram: '4 GB',
+      disk: '850 MB'
+    },
+    downloadUrl: 'https://huggingface.co/ggerganov/whisper.cpp/resolve/main/ggml-medium-q8_0.bin',
+    version: '1.0.0',
+    type: 'whisper',
+    quantization: 'q8_0',
+    baseModel: 'whisper-medium',
+    expectedFilename: 'ggml-medium-q8_0.bin'
+  },
+  {
+    id: 'whisper-large-v3-q5_0',
+    name: 'Whisper Large v3 (Quantized q5_0)',
+    provider: 'OpenAI',
+    size: '1.08 GB',
+    sizeBytes: 1080000000,
+    languages: ['multilingual'],
+    description: 'Quantized large-v3 - best accuracy tier without the 3 GB memory footprint',
+    accuracy: 'Outstanding',
+    speed: 'Slow',
+    requirements: {
+      ram: '4 GB',
+      disk: '1.2 GB'
+    },
+    downloadUrl: 'https://huggingface.co/ggerganov/whisper.cpp/resolve/main/ggml-large-v3-q5_0.bin',
+    version: '3.0.0',
+    type: 'whisper',
+    quantization: 'q5_0',
+    baseModel: 'whisper-large-v3',
+    expectedFilename: 'ggml-large-v3-q5_0.bin'
   }
 ];
 
+// Quantization types the bundled whisper.cpp quantize tool can produce locally
+const QUANTIZATION_TYPES = ['q4_0', 'q4_1', 'q5_0', 'q5_1', 'q8_0'];
+
 // Model name mapping for whisper.cpp compatibility
 const MODEL_NAME_MAPPING = {
   'whisper-tiny.bin': 'ggml-tiny.bin',
@@ -141,7 +250,17 @@ const MODEL_NAME_MAPPING = {
   'medium.bin': 'ggml-medium.bin',
   'large.bin': 'ggml-large-v3.bin',
   'large-v2.bin': 'ggml-large-v2.bin',
-  'large-v3.bin': 'ggml-large-v3.bin'
+  'large-v3.bin': 'ggml-large-v3.bin',
+
+  // tinydiarize variant (fast two-speaker mode)
+  'whisper-small.en-tdrz.bin': 'ggml-small.en-tdrz.bin',
+  'small.en-tdrz.bin': 'ggml-small.en-tdrz.bin',
+
+  // Quantized variants
+  'small-q8_0.bin': 'ggml-small-q8_0.bin',
+  'medium-q5_0.bin': 'ggml-medium-q5_0.bin',
+  'medium-q8_0.bin': 'ggml-medium-q8_0.bin',
+  'large-v3-q5_0.bin': 'ggml-large-v3-q5_0.bin'
 };
 
 // Configuration constants
@@ -150,10 +269,20 @@ const CONFIG = {
   DOWNLOAD_TIMEOUT: 30000,
   PROGRESS_EMIT_INTERVAL: 1000, // ms
   PROGRESS_EMIT_SIZE_THRESHOLD: 1024 * 1024, // 1MB
+  // Segmented downloads: parallel ranged connections per model, only worth
+  // the extra requests above the size threshold. Part files persist across
+  // failures so an interrupted download resumes instead of starting over.
+  DOWNLOAD_SEGMENTS: 4,
+  SEGMENTED_DOWNLOAD_MIN_BYTES: 64 * 1024 * 1024, // 64MB
+  // CoreML encoder bundles (ggml-<model>-encoder.mlmodelc.zip) published
+  // alongside the GGML models - fetched on macOS so the encoder can run on
+  // the Apple Neural Engine
+  COREML_ENCODER_BASE_URL: 'https://huggingface.co/ggerganov/whisper.cpp/resolve/main',
 };
 
 module.exports = {
   WHISPER_MODELS,
   MODEL_NAME_MAPPING,
+  QUANTIZATION_TYPES,
   CONFIG
 };
\ No newline at end of file
@@ -0,0 +1,292 @@
+// src/main/services/recording-transcription-pipeline.js
+// NEW: Transcribe-while-recording pipeline
+//
+// CapRecorder writes each recording's audio as a growing file
+// (content/segments/segment-N/system_audio.ogg) while capture runs. The old
+// flow waited for stop and transcribed the finished file from zero - a
+// one-hour recording meant several more minutes of waiting. This pipeline
+// tails the audio during the recording instead: every PIPELINE_INTERVAL_MS
+// it extracts the newly captured span with ffmpeg, transcribes that chunk
+// through the transcription service, and offsets the segments onto the
+// recording timeline. By the time the user hits stop only the final tail is
+// left to transcribe.
+
+const { EventEmitter } = require('events');
+const { spawn } = require('child_process');
+const path = require('path');
+const fs = require('fs').promises;
+const os = require('os');
+
+const PIPELINE_INTERVAL_MS = 30 * 1000;  // how often to pull a new chunk
+const MIN_CHUNK_SECONDS = 10;            // skip ticks that gained less audio than this
+const CHUNK_OVERLAP_SECONDS = 1.0;       // re-decode across the cut so boundary words survive
+const WAV_BYTES_PER_SECOND = 32000;      // 16kHz mono s16le - duration from file size
+const WAV_HEADER_BYTES = 44;
+
+class RecordingTranscriptionPipeline extends EventEmitter {
+  constructor(transcriptionService, settingsService) {
+    super();
+    this.transcriptionService = transcriptionService;
+    this.settingsService = settingsService;
+    this.session = null;
+    this.busy = false;
+    this.tempDir = path.join(os.tmpdir(), 'whisperdesk-pipeline');
+  }
+
+  // Subscribe to the recorder's lifecycle events. The pipeline stays passive
+  // until a recording actually starts.
+  attach(screenRecorder) {
+    screenRecorder.on('recordingStarted', (data) => {
+      this.handleRecordingStarted(data).catch(error => {
+        console.warn('⚠️ Pipeline failed to start:', error.message);
+      });
+    });
+    screenRecorder.on('recordingStopped', (data) => {
+      this.handleRecordingStopped(data).catch(error => {
+        console.warn('⚠️ Pipeline finalization failed:', error.message);
+      });
+    });
+    screenRecorder.on('recordingCanceled', () => this.handleRecordingCanceled());
+    console.log('🎬 Transcribe-while-recording pipeline attached');
+  }
+
+  isEnabled() {
+    // Reuse the existing auto-transcribe toggle: when the user wants the
+    // recording transcribed anyway, do the work during capture instead of after
+    return this.settingsService?.get('autoTranscribeRecordings') !== false;
+  }
+
+  async handleRecordingStarted({ recordingId, outputPath }) {
+    if (!this.isEnabled() || this.session) {
+      return;
+    }
+
+    const provider = this.transcriptionService.getProvider('whisper-native');
+    if (!provider || !provider.isAvailable()) {
+      console.log('💡 Pipeline idle - native whisper provider not available');
+      return;
+    }
+
+    await fs.mkdir(this.tempDir, { recursive: true });
+
+    this.session = {
+      recordingId,
+      outputPath,
+      audioFile: null,
+      processedSeconds: 0,
+      chunkIndex: 0,
+      segments: [],
+      stopped: false,
+      timer: null
+    };
+
+    this.session.timer = setInterval(() => {
+      this.tick(false).catch(error => {
+        console.warn('⚠️ Pipeline chunk failed:', error.message);
+      });
+    }, PIPELINE_INTERVAL_MS);
+
+    console.log(`🎬 Pipelined transcription started for ${recordingId}`);
+    this.emit('pipelineStarted', { recordingId });
+  }
+
+  // CapRecorder's on-disk layout: <recording>/content/segments/segment-N/
+  // with system_audio.ogg when audio capture is on. Audio-less recordings
+  // leave the pipeline idle.
+  async findAudioFile(outputPath) {
+    const segmentsDir = path.join(outputPath, 'content', 'segments');
+    try {
+      const entries = await fs.readdir(segmentsDir);
+      const segmentDirs = entries
+        .filter(name => name.startsWith('segment-'))
+        .sort((a, b) => parseInt(a.split('-')[1], 10) - parseInt(b.split('-')[1], 10));
+
+      for (const dir of segmentDirs.reverse()) {
+        const candidate = path.join(segmentsDir, dir, 'system_audio.ogg');
+        try {
+          await fs.access(candidate);
+          return candidate;
+        } catch {
+          // No audio in this segment - keep looking
+        }
+      }
+    } catch {
+      // Recording has not materialized its segment layout yet
+    }
+    return null;
+  }
+
+  // Pull the audio captured since the last tick and transcribe it. Ticks
+  // never overlap: a slow chunk simply makes the next one larger.
+  async tick(final) {
+    const session = this.session;
+    if (!session || this.busy) {
+      return;
+    }
+    this.busy = true;
+
+    let chunkPath = null;
+    try {
+      if (!session.audioFile) {
+        session.audioFile = await this.findAudioFile(session.outputPath);
+        if (!session.audioFile) {
+          return;
+        }
+        console.log(`🔊 Pipeline found recording audio: ${session.audioFile}`);
+      }
+
+      // Cut slightly before the processed point so words straddling the
+      // previous cut are decoded whole; duplicates are dropped below
+      const cutStart = Math.max(0, session.processedSeconds - CHUNK_OVERLAP_SECONDS);
+      chunkPath = path.join(this.tempDir, `${session.recordingId}_chunk${session.chunkIndex}.wav`);
+
+      await this.extractChunk(session.audioFile, cutStart, chunkPath);
+
+      const stats = await fs.stat(chunkPath);
+      const chunkSeconds = Math.max(0, (stats.size - WAV_HEADER_BYTES) / WAV_BYTES_PER_SECOND);
+      const newSeconds = cutStart + chunkSeconds - session.processedSeconds;
+
+      if (newSeconds <= 0 || (!final && newSeconds < MIN_CHUNK_SECONDS)) {
+        return;
+      }
+
+      session.chunkIndex++;
+      const result = await this.transcriptionService.getProvider('whisper-native').processFile(chunkPath, {
+        transcriptionId: `${session.recordingId}_pipe_${session.chunkIndex}`,
+        // Diarization and caching run once on the assembled result, not per chunk
+        enableSpeakerDiarization: false,
+        cache: false,
+        vadFilter: false,
+        wordTimestamps: false
+      });
+
+      // Shift chunk segments onto the recording timeline and drop the ones
+      // that fall entirely inside the already-processed overlap span
+      const accepted = (result.segments || [])
+        .map(segment => ({
+          ...segment,
+          start: segment.start + cutStart,
+          end: segment.end + cutStart
+        }))
+        .filter(segment => segment.end > session.processedSeconds + 0.25);
+
+      session.segments.push(...accepted);
+      session.processedSeconds = cutStart + chunkSeconds;
+
+      console.log(`⏱️ Pipeline transcribed ${Math.round(session.processedSeconds)}s (${session.segments.length} segments)`);
+      this.emit('pipelineProgress', {
+        recordingId: session.recordingId,
+        transcribedSeconds: session.processedSeconds,
+        segmentCount: session.segments.length
+      });
+    } finally {
+      if (chunkPath) {
+        fs.unlink(chunkPath).catch(() => {});
+      }
+      this.busy = false;
+    }
+  }
+
+  // ffmpeg extracts the span after the cut point as 16kHz mono WAV - the
+  // same format the provider's preprocessing would produce
+  extractChunk(audioFile, startSeconds, chunkPath) {
+    return new Promise((resolve, reject) => {
+      const args = [
+        '-nostdin',
+        '-ss', startSeconds.toString(),
+        '-i', audioFile,
+        '-ar', '16000',
+        '-ac', '1',
+        '-f', 'wav',
+        '-y', chunkPath
+      ];
+
+      const ffmpegProcess = spawn('ffmpeg', args, { stdio: ['ignore', 'ignore', 'pipe'] });
+      let stderr = '';
+      ffmpegProcess.stderr.on('data', (data) => {
+        stderr += data.toString();
+      });
+      ffmpegProcess.on('close', (code) => {
+        if (code === 0) {
+          resolve();
+        } else {
+          reject(new Error(`ffmpeg chunk extraction failed: ${stderr.split('\n').pop() || code}`));
+        }
+      });
+      ffmpegProcess.on('error', (error) => {
+        reject(new Error(`Failed to start ffmpeg: ${error.message}`));
+      });
+    });
+  }
+
+  async handleRecordingStopped({ recordingId, outputPath }) {
+    const session = this.session;
+    if (!session || session.recordingId !== recordingId) {
+      return;
+    }
+
+    clearInterval(session.timer);
+    session.stopped = true;
+
+    // Let an in-flight chunk finish, then transcribe the remaining tail from
+    // the finished file - usually seconds of audio, not the whole recording
+    while (this.busy) {
+      await new Promise(resolve => setTimeout(resolve, 250));
+    }
+    try {
+      await this.tick(true);
+    } catch (error) {
+      console.warn('⚠️ Pipeline tail chunk failed:', error.message);
+    }
+
+    this.session = null;
+
+    const segments = session.segments.sort((a, b) => a.start - b.start);
+    const result = {
+      text: segments.map(segment => segment.text).join(' ').trim(),
+      segments,
+      metadata: {
+        provider: 'whisper-native',
+        pipelined: true,
+        duration: session.processedSeconds,
+        chunks: session.chunkIndex,
+        recordingPath: outputPath,
+        timestamp: new Date().toISOString()
+      }
+    };
+
+    console.log(`✅ Pipelined transcript ready: ${segments.length} segments over ${Math.round(session.processedSeconds)}s`);
+
+    // Surface through the same event channel as a normal file transcription
+    // so the existing UI completion path picks it up unchanged
+    this.transcriptionService.emit('complete', {
+      transcriptionId: recordingId,
+      result,
+      provider: 'whisper-native'
+    });
+    this.emit('pipelineComplete', { recordingId, result });
+  }
+
+  handleRecordingCanceled() {
+    if (!this.session) {
+      return;
+    }
+    clearInterval(this.session.timer);
+    console.log(`🚫 Pipeline aborted for ${this.session.recordingId}`);
+    this.session = null;
+  }
+
+  getStatus() {
+    if (!this.session) {
+      return { active: false };
+    }
+    return {
+      active: true,
+      recordingId: this.session.recordingId,
+      transcribedSeconds: this.session.processedSeconds,
+      segmentCount: this.session.segments.length
+    };
+  }
+}
+
+module.exports = RecordingTranscriptionPipeline;
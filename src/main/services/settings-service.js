@@ -54,6 +54,11 @@ class SettingsService {
         autoScroll: true,
         fontSize: 'medium',
         
+        // Performance tuning (written by the one-time calibration pass in
+        // benchmark-service; 0 / 'auto' = not calibrated yet)
+        tunedThreads: 0,
+        tunedBackend: 'auto', // 'auto', 'gpu', 'cpu'
+
         // Advanced settings
         maxConcurrentDownloads: 2,
         modelCacheSize: '5GB',
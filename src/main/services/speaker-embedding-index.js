@@ -0,0 +1,241 @@
+// src/main/services/speaker-embedding-index.js - Persistent speaker-embedding index
+// Stores one L2-normalized embedding centroid per known speaker as a packed
+// float32 matrix (embeddings.bin) plus a JSON manifest (embeddings.json), both
+// under ~/.whisperdesk/speakers next to the existing speaker profiles. The
+// matrix is held in memory, so answering "which known speaker is this?" is a
+// single cosine-similarity pass - through the native addon's embeddingSearch
+// when built, otherwise a plain JS dot-product loop - instead of re-embedding
+// anything.
+
+const fs = require('fs').promises;
+const path = require('path');
+const os = require('os');
+
+const INDEX_VERSION = 1;
+// Cosine similarity a query must reach to count as a known speaker
+const MATCH_THRESHOLD = 0.6;
+
+class SpeakerEmbeddingIndex {
+  constructor(dataDir = path.join(os.homedir(), '.whisperdesk', 'speakers')) {
+    this.dataDir = dataDir;
+    this.manifestPath = path.join(dataDir, 'embeddings.json');
+    this.vectorsPath = path.join(dataDir, 'embeddings.bin');
+
+    this.dim = 0;
+    // Row i of the matrix belongs to entries[i]
+    this.entries = []; // [{ speakerId, samples, updatedAt }]
+    this.matrix = new Float32Array(0); // row-major, L2-normalized rows
+    this.addonBinding = null;
+    this.loaded = false;
+  }
+
+  async initialize() {
+    try {
+      this.addonBinding = require('../../../native/whisperdesk-whisper');
+    } catch (error) {
+      this.addonBinding = null; // JS fallback still works, just not SIMD
+    }
+
+    await fs.mkdir(this.dataDir, { recursive: true });
+
+    try {
+      const manifest = JSON.parse(await fs.readFile(this.manifestPath, 'utf8'));
+      const raw = await fs.readFile(this.vectorsPath);
+
+      if (manifest.version === INDEX_VERSION &&
+          raw.length === manifest.entries.length * manifest.dim * 4) {
+        this.dim = manifest.dim;
+        this.entries = manifest.entries;
+        // Copy out of the Buffer pool (its byteOffset may not be 4-aligned)
+        this.matrix = new Float32Array(raw.buffer.slice(raw.byteOffset, raw.byteOffset + raw.length));
+        console.log(`📇 Speaker embedding index loaded: ${this.entries.length} speakers (dim ${this.dim})`);
+      } else {
+        console.warn('⚠️ Speaker embedding index is stale or corrupt, starting fresh');
+      }
+    } catch (error) {
+      console.log('No existing speaker embedding index found, starting fresh');
+    }
+
+    this.loaded = true;
+  }
+
+  get size() {
+    return this.entries.length;
+  }
+
+  async persist() {
+    const manifest = {
+      version: INDEX_VERSION,
+      dim: this.dim,
+      entries: this.entries
+    };
+    await fs.writeFile(this.manifestPath, JSON.stringify(manifest, null, 2));
+    await fs.writeFile(this.vectorsPath, Buffer.from(this.matrix.buffer, this.matrix.byteOffset, this.matrix.length * 4));
+  }
+
+  normalize(embedding) {
+    const vector = Float32Array.from(embedding);
+    let norm = 0;
+    for (let i = 0; i < vector.length; i++) {
+      norm += vector[i] * vector[i];
+    }
+    norm = Math.sqrt(norm);
+    if (!norm || !isFinite(norm)) {
+      return null;
+    }
+    for (let i = 0; i < vector.length; i++) {
+      vector[i] /= norm;
+    }
+    return vector;
+  }
+
+  rowOf(speakerId) {
+    return this.entries.findIndex(entry => entry.speakerId === speakerId);
+  }
+
+  /**
+   * Add or reinforce a speaker's embedding. Repeat enrollments fold into a
+   * running centroid (weighted by sample count) so the stored vector converges
+   * on the speaker's typical voice instead of the last recording.
+   */
+  async upsert(speakerId, embedding) {
+    const vector = this.normalize(embedding);
+    if (!vector) {
+      return false;
+    }
+
+    if (this.dim === 0) {
+      this.dim = vector.length;
+    } else if (vector.length !== this.dim) {
+      console.warn(`⚠️ Embedding dim mismatch (got ${vector.length}, index is ${this.dim}) - skipping enrollment`);
+      return false;
+    }
+
+    const row = this.rowOf(speakerId);
+    if (row >= 0) {
+      const entry = this.entries[row];
+      const base = row * this.dim;
+      const weight = entry.samples;
+      const blended = new Float32Array(this.dim);
+      for (let i = 0; i < this.dim; i++) {
+        blended[i] = (this.matrix[base + i] * weight + vector[i]) / (weight + 1);
+      }
+      const renormalized = this.normalize(blended) || vector;
+      this.matrix.set(renormalized, base);
+      entry.samples += 1;
+      entry.updatedAt = new Date().toISOString();
+    } else {
+      const grown = new Float32Array(this.matrix.length + this.dim);
+      grown.set(this.matrix);
+      grown.set(vector, this.matrix.length);
+      this.matrix = grown;
+      this.entries.push({
+        speakerId,
+        samples: 1,
+        updatedAt: new Date().toISOString()
+      });
+    }
+
+    await this.persist();
+    return true;
+  }
+
+  /**
+   * Top-k cosine search over every enrolled speaker. Returns
+   * [{ speakerId, score }] sorted by score descending.
+   */
+  search(embedding, topK = 3) {
+    if (this.entries.length === 0) {
+      return [];
+    }
+
+    const query = this.normalize(embedding);
+    if (!query || query.length !== this.dim) {
+      return [];
+    }
+
+    if (this.addonBinding && typeof this.addonBinding.embeddingSearch === 'function') {
+      try {
+        return this.addonBinding
+          .embeddingSearch(query, this.matrix, this.dim, topK)
+          .map(match => ({
+            speakerId: this.entries[match.index].speakerId,
+            score: match.score
+          }));
+      } catch (error) {
+        console.warn(`⚠️ Native embedding search failed, using JS fallback: ${error.message}`);
+      }
+    }
+
+    const scores = this.entries.map((entry, row) => {
+      const base = row * this.dim;
+      let dot = 0;
+      for (let i = 0; i < this.dim; i++) {
+        dot += this.matrix[base + i] * query[i];
+      }
+      return { speakerId: entry.speakerId, score: dot };
+    });
+
+    scores.sort((a, b) => b.score - a.score);
+    return scores.slice(0, topK);
+  }
+
+  /** Best match above the recognition threshold, or null. */
+  match(embedding) {
+    const [best] = this.search(embedding, 1);
+    return best && best.score >= MATCH_THRESHOLD ? best : null;
+  }
+
+  async remove(speakerId) {
+    const row = this.rowOf(speakerId);
+    if (row < 0) {
+      return false;
+    }
+
+    this.entries.splice(row, 1);
+    const shrunk = new Float32Array(this.matrix.length - this.dim);
+    shrunk.set(this.matrix.subarray(0, row * this.dim));
+    shrunk.set(this.matrix.subarray((row + 1) * this.dim), row * this.dim);
+    this.matrix = shrunk;
+
+    await this.persist();
+    return true;
+  }
+
+  /** Fold the secondary speaker's centroid into the primary's and drop it. */
+  async merge(primarySpeakerId, secondarySpeakerId) {
+    const primaryRow = this.rowOf(primarySpeakerId);
+    const secondaryRow = this.rowOf(secondarySpeakerId);
+    if (secondaryRow < 0) {
+      return false;
+    }
+    if (primaryRow < 0) {
+      // Primary has no embedding yet - the secondary's becomes it
+      this.entries[secondaryRow].speakerId = primarySpeakerId;
+      await this.persist();
+      return true;
+    }
+
+    const primary = this.entries[primaryRow];
+    const secondary = this.entries[secondaryRow];
+    const total = primary.samples + secondary.samples;
+    const blended = new Float32Array(this.dim);
+    const primaryBase = primaryRow * this.dim;
+    const secondaryBase = secondaryRow * this.dim;
+    for (let i = 0; i < this.dim; i++) {
+      blended[i] = (this.matrix[primaryBase + i] * primary.samples +
+                    this.matrix[secondaryBase + i] * secondary.samples) / total;
+    }
+    const renormalized = this.normalize(blended);
+    if (renormalized) {
+      this.matrix.set(renormalized, primaryBase);
+    }
+    primary.samples = total;
+    primary.updatedAt = new Date().toISOString();
+
+    return this.remove(secondarySpeakerId);
+  }
+}
+
+module.exports = SpeakerEmbeddingIndex;
+module.exports.MATCH_THRESHOLD = MATCH_THRESHOLD;
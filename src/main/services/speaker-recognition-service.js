@@ -2,6 +2,7 @@ const { EventEmitter } = require('events');
 const fs = require('fs').promises;
 const path = require('path');
 const os = require('os');
+const SpeakerEmbeddingIndex = require('./speaker-embedding-index');
 
 class SpeakerRecognitionService extends EventEmitter {
   constructor() {
@@ -9,6 +10,7 @@ class SpeakerRecognitionService extends EventEmitter {
     this.speakers = new Map(); // Store speaker profiles
     this.speakerLabels = new Map(); // Map speaker IDs to custom labels
     this.voicePrints = new Map(); // Store voice characteristics
+    this.embeddingIndex = null; // Persistent embedding index for cross-recording recognition
     this.isInitialized = false;
     this.speakerDataPath = path.join(os.homedir(), '.whisperdesk', 'speakers');
   }
@@ -17,10 +19,20 @@ class SpeakerRecognitionService extends EventEmitter {
     try {
       // Create speakers directory
       await fs.mkdir(this.speakerDataPath, { recursive: true });
-      
+
       // Load existing speaker data
       await this.loadSpeakerData();
-      
+
+      // Load the persistent embedding index (fast "which known speaker is
+      // this?" lookups when diarize-cli emits embedding vectors)
+      try {
+        this.embeddingIndex = new SpeakerEmbeddingIndex(this.speakerDataPath);
+        await this.embeddingIndex.initialize();
+      } catch (indexError) {
+        console.warn('Speaker embedding index unavailable:', indexError.message);
+        this.embeddingIndex = null;
+      }
+
       this.isInitialized = true;
       console.log('Speaker recognition service initialized');
     } catch (error) {
@@ -101,10 +113,32 @@ class SpeakerRecognitionService extends EventEmitter {
       const processedSegments = [];
       const detectedSpeakers = new Set();
 
+      // Resolve recording-local speakers against the persistent embedding
+      // index first: a matched embedding maps every segment of that local
+      // speaker straight to the known speaker, no per-segment heuristics
+      const embeddingMatches = await this.resolveSpeakerEmbeddings(
+        transcriptionResult.metadata?.speakerEmbeddings
+      );
+
       for (const segment of segments) {
-        const processedSegment = await this.processSegment(segment);
+        let processedSegment;
+        const embeddingMatch = embeddingMatches && segment.speakerId
+          ? embeddingMatches.get(segment.speakerId)
+          : null;
+
+        if (embeddingMatch) {
+          processedSegment = {
+            ...segment,
+            speakerId: embeddingMatch.speakerId,
+            speakerLabel: embeddingMatch.label,
+            recognitionMethod: 'embedding_index',
+            recognitionScore: embeddingMatch.score
+          };
+        } else {
+          processedSegment = await this.processSegment(segment);
+        }
         processedSegments.push(processedSegment);
-        
+
         if (processedSegment.speakerId) {
           detectedSpeakers.add(processedSegment.speakerId);
         }
@@ -125,6 +159,78 @@ class SpeakerRecognitionService extends EventEmitter {
     }
   }
 
+  /**
+   * Map recording-local speaker IDs (speaker_1, speaker_2, ...) to known
+   * speakers via the embedding index. Matches reinforce the stored centroid;
+   * unknown voices are enrolled as new speakers so the next recording
+   * recognizes them. Returns a Map localSpeakerId -> { speakerId, label,
+   * score }, or null when there is nothing to resolve.
+   */
+  async resolveSpeakerEmbeddings(speakerEmbeddings) {
+    if (!this.embeddingIndex || !speakerEmbeddings || typeof speakerEmbeddings !== 'object') {
+      return null;
+    }
+
+    const matches = new Map();
+
+    for (const [localSpeakerId, embedding] of Object.entries(speakerEmbeddings)) {
+      if (!Array.isArray(embedding) || embedding.length === 0) {
+        continue;
+      }
+
+      const match = this.embeddingIndex.match(embedding);
+      if (match) {
+        // Known voice - reinforce its centroid with this recording
+        await this.embeddingIndex.upsert(match.speakerId, embedding);
+        const speaker = this.speakers.get(match.speakerId);
+        if (speaker) {
+          speaker.lastSeen = new Date().toISOString();
+        }
+        matches.set(localSpeakerId, {
+          speakerId: match.speakerId,
+          label: this.getSpeakerLabel(match.speakerId),
+          score: match.score
+        });
+        console.log(`📇 ${localSpeakerId} recognized as ${this.getSpeakerLabel(match.speakerId)} (cosine ${match.score.toFixed(3)})`);
+      } else {
+        // New voice - enroll it so future recordings can match
+        const speakerId = this.generateSpeakerId();
+        await this.createSpeakerProfile(speakerId, localSpeakerId);
+        await this.embeddingIndex.upsert(speakerId, embedding);
+        matches.set(localSpeakerId, {
+          speakerId,
+          label: this.getSpeakerLabel(speakerId),
+          score: 0
+        });
+        console.log(`📇 ${localSpeakerId} enrolled as new speaker ${speakerId}`);
+      }
+    }
+
+    return matches.size > 0 ? matches : null;
+  }
+
+  /**
+   * Direct embedding lookup for callers that already have a vector.
+   * Returns { speakerId, confidence, label } or null, mirroring
+   * identifySpeaker().
+   */
+  identifySpeakerByEmbedding(embedding) {
+    if (!this.embeddingIndex) {
+      return null;
+    }
+
+    const match = this.embeddingIndex.match(embedding);
+    if (!match) {
+      return null;
+    }
+
+    return {
+      speakerId: match.speakerId,
+      confidence: match.score,
+      label: this.getSpeakerLabel(match.speakerId)
+    };
+  }
+
   async processSegment(segment) {
     const { speaker, text, start, end, confidence } = segment;
     
@@ -350,7 +456,11 @@ class SpeakerRecognitionService extends EventEmitter {
     this.speakers.delete(speakerId);
     this.speakerLabels.delete(speakerId);
     this.voicePrints.delete(speakerId);
-    
+
+    if (this.embeddingIndex) {
+      await this.embeddingIndex.remove(speakerId);
+    }
+
     await this.saveSpeakerData();
     
     this.emit('speakerDeleted', { speakerId });
@@ -395,6 +505,11 @@ class SpeakerRecognitionService extends EventEmitter {
       this.voicePrints.set(primarySpeakerId, primaryVoicePrint);
     }
 
+    // Fold the embedding centroids together before the secondary is deleted
+    if (this.embeddingIndex) {
+      await this.embeddingIndex.merge(primarySpeakerId, secondarySpeakerId);
+    }
+
     // Delete secondary speaker
     await this.deleteSpeaker(secondarySpeakerId);
     
@@ -519,6 +634,7 @@ class SpeakerRecognitionService extends EventEmitter {
       totalSegments,
       totalDuration,
       averageConfidence,
+      indexedEmbeddings: this.embeddingIndex ? this.embeddingIndex.size : 0,
       lastUpdated: new Date().toISOString()
     };
   }
@@ -0,0 +1,196 @@
+// src/main/services/transcription-cache.js - Content-addressed recompute cache
+// Re-running the same file with different options used to redo ffmpeg
+// conversion, whisper decoding, and diarization from scratch. Each source
+// file gets a content fingerprint (size + sampled regions, so multi-GB video
+// hashes in milliseconds), and under that key the cache stores the converted
+// WAV, transcript segments per transcription-option set, and diarization
+// segments per diarization-option set. Toggling diarization settings reuses
+// the cached transcript; a straight re-run reuses everything. Every method
+// degrades to a miss on error - the cache can never fail a job.
+
+const fs = require('fs').promises;
+const path = require('path');
+const os = require('os');
+const crypto = require('crypto');
+
+// Bytes sampled from the start, middle, and end of the file for the fingerprint
+const SAMPLE_BYTES = 1024 * 1024;
+// Entries untouched for this long are pruned on startup
+const MAX_AGE_MS = 7 * 24 * 60 * 60 * 1000;
+// Hard cap on cached source files (oldest evicted first)
+const MAX_ENTRIES = 50;
+
+class TranscriptionCache {
+  constructor(cacheDir = path.join(os.tmpdir(), 'whisperdesk-cache')) {
+    this.cacheDir = cacheDir;
+    this.initialized = false;
+  }
+
+  async ensureInitialized() {
+    if (this.initialized) return;
+    await fs.mkdir(this.cacheDir, { recursive: true });
+    await this.prune();
+    this.initialized = true;
+  }
+
+  /**
+   * Content fingerprint: sha256 over file size plus up to three sampled
+   * regions. Sampling keeps hashing multi-GB recordings instant while still
+   * changing whenever the audio content does.
+   */
+  async hashFile(filePath) {
+    try {
+      const stat = await fs.stat(filePath);
+      const hash = crypto.createHash('sha256');
+      hash.update(`size:${stat.size}`);
+
+      const handle = await fs.open(filePath, 'r');
+      try {
+        const offsets = [0, Math.floor(stat.size / 2), Math.max(0, stat.size - SAMPLE_BYTES)];
+        const buffer = Buffer.alloc(SAMPLE_BYTES);
+        for (const offset of offsets) {
+          const { bytesRead } = await handle.read(buffer, 0, SAMPLE_BYTES, offset);
+          hash.update(buffer.subarray(0, bytesRead));
+          if (stat.size <= SAMPLE_BYTES) break; // Small file - one read covers it
+        }
+      } finally {
+        await handle.close();
+      }
+
+      return hash.digest('hex').substring(0, 32);
+    } catch (error) {
+      console.warn(`⚠️ Could not fingerprint ${path.basename(filePath)}: ${error.message}`);
+      return null;
+    }
+  }
+
+  /** Stable short key for an options object (key order does not matter). */
+  optionsKey(options) {
+    const sorted = Object.keys(options).sort().map(key => `${key}=${JSON.stringify(options[key])}`);
+    return crypto.createHash('sha256').update(sorted.join('&')).digest('hex').substring(0, 12);
+  }
+
+  entryDir(contentHash) {
+    return path.join(this.cacheDir, contentHash);
+  }
+
+  async touch(contentHash) {
+    const now = new Date();
+    await fs.utimes(this.entryDir(contentHash), now, now).catch(() => {});
+  }
+
+  // --- Converted WAV (option-independent) ---
+
+  async getConvertedWav(contentHash) {
+    try {
+      await this.ensureInitialized();
+      const wavPath = path.join(this.entryDir(contentHash), 'converted.wav');
+      await fs.access(wavPath);
+      await this.touch(contentHash);
+      return wavPath;
+    } catch (error) {
+      return null;
+    }
+  }
+
+  async putConvertedWav(contentHash, wavPath) {
+    try {
+      await this.ensureInitialized();
+      await fs.mkdir(this.entryDir(contentHash), { recursive: true });
+      await fs.copyFile(wavPath, path.join(this.entryDir(contentHash), 'converted.wav'));
+      return true;
+    } catch (error) {
+      console.warn(`⚠️ Failed to cache converted WAV: ${error.message}`);
+      return false;
+    }
+  }
+
+  // --- JSON payloads (transcript keyed by transcription options, diarization
+  // keyed by diarization options) ---
+
+  async getJson(contentHash, filename) {
+    try {
+      await this.ensureInitialized();
+      const data = await fs.readFile(path.join(this.entryDir(contentHash), filename), 'utf8');
+      await this.touch(contentHash);
+      return JSON.parse(data);
+    } catch (error) {
+      return null;
+    }
+  }
+
+  async putJson(contentHash, filename, payload) {
+    try {
+      await this.ensureInitialized();
+      await fs.mkdir(this.entryDir(contentHash), { recursive: true });
+      await fs.writeFile(path.join(this.entryDir(contentHash), filename), JSON.stringify(payload));
+      return true;
+    } catch (error) {
+      console.warn(`⚠️ Failed to cache ${filename}: ${error.message}`);
+      return false;
+    }
+  }
+
+  getTranscript(contentHash, optionsKey) {
+    return this.getJson(contentHash, `transcript-${optionsKey}.json`);
+  }
+
+  putTranscript(contentHash, optionsKey, result) {
+    return this.putJson(contentHash, `transcript-${optionsKey}.json`, result);
+  }
+
+  // Detected language is a property of the audio itself, so like the
+  // converted WAV it is option-independent
+  getLanguage(contentHash) {
+    return this.getJson(contentHash, 'language.json');
+  }
+
+  putLanguage(contentHash, detection) {
+    return this.putJson(contentHash, 'language.json', detection);
+  }
+
+  getDiarization(contentHash, optionsKey) {
+    return this.getJson(contentHash, `diarization-${optionsKey}.json`);
+  }
+
+  putDiarization(contentHash, optionsKey, result) {
+    return this.putJson(contentHash, `diarization-${optionsKey}.json`, result);
+  }
+
+  /** Drop stale entries and enforce the entry cap (oldest first). */
+  async prune() {
+    try {
+      const names = await fs.readdir(this.cacheDir);
+      const entries = [];
+      for (const name of names) {
+        const dir = path.join(this.cacheDir, name);
+        try {
+          const stat = await fs.stat(dir);
+          if (stat.isDirectory()) {
+            entries.push({ dir, mtimeMs: stat.mtimeMs });
+          }
+        } catch (error) {
+          // Entry disappeared mid-scan - nothing to prune
+        }
+      }
+
+      const now = Date.now();
+      const expired = entries.filter(entry => now - entry.mtimeMs > MAX_AGE_MS);
+      const live = entries.filter(entry => now - entry.mtimeMs <= MAX_AGE_MS)
+        .sort((a, b) => a.mtimeMs - b.mtimeMs);
+      const overflow = live.slice(0, Math.max(0, live.length - MAX_ENTRIES));
+
+      for (const entry of [...expired, ...overflow]) {
+        await fs.rm(entry.dir, { recursive: true, force: true });
+      }
+
+      if (expired.length + overflow.length > 0) {
+        console.log(`🧹 Pruned ${expired.length + overflow.length} cache entries from ${this.cacheDir}`);
+      }
+    } catch (error) {
+      // Cache dir may not exist yet - nothing to prune
+    }
+  }
+}
+
+module.exports = TranscriptionCache;
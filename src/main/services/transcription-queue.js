@@ -0,0 +1,184 @@
+// src/main/services/transcription-queue.js
+// NEW: Scheduling engine for transcription jobs
+//
+// The service used to run jobs effectively one at a time - dropping 50 files
+// on the app processed them serially while most cores idled. This queue runs
+// jobs with bounded parallelism and memory-aware admission control: each job
+// declares its model, the queue estimates the resident memory that model
+// needs while decoding, and a job only starts while the running set still
+// fits inside the memory budget. Interactively started jobs (user clicked
+// "transcribe") jump ahead of batch jobs (folder drops), and every state
+// change is emitted so the UI can show the queue.
+
+const { EventEmitter } = require('events');
+const os = require('os');
+
+// Approximate resident memory per model family while transcribing (weights +
+// KV cache + mel/decode buffers), keyed by model id prefix. Quantized
+// variants match their base family, which overestimates slightly - safe side.
+const MODEL_MEMORY_GB = {
+  'large': 4.5,
+  'medium': 2.8,
+  'small': 1.2,
+  'base': 0.6,
+  'tiny': 0.4
+};
+const DEFAULT_MODEL_MEMORY_GB = 1.0;  // unknown model id
+const CLOUD_JOB_MEMORY_GB = 0.1;      // cloud providers hold no weights locally
+
+const PRIORITY = {
+  interactive: 0,
+  batch: 1
+};
+
+class TranscriptionQueue extends EventEmitter {
+  constructor(options = {}) {
+    super();
+    const cores = os.cpus().length;
+
+    // Each native whisper job uses ~4 threads, so parallelism beyond
+    // cores / 4 just causes contention instead of throughput
+    this.maxParallel = options.maxParallel || Math.max(1, Math.min(3, Math.floor(cores / 4)));
+
+    // Leave roughly half of physical memory for the OS, Electron and decode
+    // buffers - two large-v3 jobs on an 8GB machine would swap otherwise
+    this.memoryBudgetGB = options.memoryBudgetGB ||
+      Math.max(DEFAULT_MODEL_MEMORY_GB, Math.round((os.totalmem() / (1024 ** 3)) / 2 * 10) / 10);
+
+    this.queued = [];
+    this.running = new Map();
+    this.sequence = 0;
+
+    console.log(`🚦 Transcription queue ready (parallelism ${this.maxParallel}, memory budget ${this.memoryBudgetGB}GB)`);
+  }
+
+  // Memory cost of a job: cloud jobs are nearly free locally, native jobs
+  // cost whatever their model family needs
+  estimateMemoryGB(model, provider) {
+    if (provider && provider !== 'whisper-native') {
+      return CLOUD_JOB_MEMORY_GB;
+    }
+    const modelId = (model || '').toLowerCase();
+    for (const [prefix, memoryGB] of Object.entries(MODEL_MEMORY_GB)) {
+      if (modelId.includes(prefix)) {
+        return memoryGB;
+      }
+    }
+    return DEFAULT_MODEL_MEMORY_GB;
+  }
+
+  memoryInUseGB() {
+    let used = 0;
+    for (const job of this.running.values()) {
+      used += job.memoryGB;
+    }
+    return Math.round(used * 10) / 10;
+  }
+
+  /**
+   * Queue a job and resolve/reject with its result. `run` is the async job
+   * body; it is not invoked until the scheduler admits the job.
+   */
+  enqueue({ id, model, provider, priority = 'interactive', run }) {
+    return new Promise((resolve, reject) => {
+      const job = {
+        id,
+        model: model || 'unknown',
+        provider: provider || 'whisper-native',
+        priority: PRIORITY[priority] !== undefined ? priority : 'interactive',
+        memoryGB: this.estimateMemoryGB(model, provider),
+        enqueuedAt: Date.now(),
+        seq: this.sequence++,
+        run,
+        resolve,
+        reject
+      };
+
+      this.queued.push(job);
+      // Stable order: interactive before batch, FIFO within a priority
+      this.queued.sort((a, b) =>
+        (PRIORITY[a.priority] - PRIORITY[b.priority]) || (a.seq - b.seq));
+
+      console.log(`🚦 Queued ${job.priority} job ${id} (${job.memoryGB}GB, position ${this.queued.indexOf(job) + 1})`);
+      this.pump();
+    });
+  }
+
+  // Cancel a job that has not started yet. Running jobs are cancelled through
+  // the provider, not here.
+  cancel(id) {
+    const index = this.queued.findIndex(job => job.id === id);
+    if (index === -1) {
+      return false;
+    }
+    const [job] = this.queued.splice(index, 1);
+    job.reject(new Error('Transcription cancelled while queued'));
+    this.emitState();
+    return true;
+  }
+
+  // Admission control: a job starts when a parallelism slot is free and its
+  // memory fits in the budget. An idle queue always admits the head job so a
+  // single large-v3 job on a small machine is never starved.
+  canAdmit(job) {
+    if (this.running.size >= this.maxParallel) {
+      return false;
+    }
+    if (this.running.size === 0) {
+      return true;
+    }
+    return this.memoryInUseGB() + job.memoryGB <= this.memoryBudgetGB;
+  }
+
+  pump() {
+    while (this.queued.length > 0 && this.canAdmit(this.queued[0])) {
+      const job = this.queued.shift();
+      job.startedAt = Date.now();
+      this.running.set(job.id, job);
+      console.log(`🚦 Starting job ${job.id} (${this.running.size}/${this.maxParallel} slots, ${this.memoryInUseGB()}/${this.memoryBudgetGB}GB)`);
+      this.emitState();
+
+      Promise.resolve()
+        .then(() => job.run())
+        .then(result => job.resolve(result))
+        .catch(error => job.reject(error))
+        .finally(() => {
+          this.running.delete(job.id);
+          this.emitState();
+          this.pump();
+        });
+    }
+    this.emitState();
+  }
+
+  getState() {
+    return {
+      maxParallel: this.maxParallel,
+      memoryBudgetGB: this.memoryBudgetGB,
+      memoryInUseGB: this.memoryInUseGB(),
+      running: Array.from(this.running.values()).map(job => ({
+        id: job.id,
+        model: job.model,
+        provider: job.provider,
+        priority: job.priority,
+        memoryGB: job.memoryGB,
+        startedAt: job.startedAt
+      })),
+      queued: this.queued.map((job, index) => ({
+        id: job.id,
+        model: job.model,
+        provider: job.provider,
+        priority: job.priority,
+        memoryGB: job.memoryGB,
+        position: index + 1,
+        enqueuedAt: job.enqueuedAt
+      }))
+    };
+  }
+
+  emitState() {
+    this.emit('queueChanged', this.getState());
+  }
+}
+
+module.exports = TranscriptionQueue;
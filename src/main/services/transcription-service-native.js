@@ -9,6 +9,8 @@ const transcriptionStore = require('./transcription-store');
 const BinaryManager = require('./binary-manager-dll');
 const NativeWhisperProvider = require('./providers/native-whisper-provider-dll');
 const DeepgramProvider = require('./providers/deepgram-provider');
+const LiveTranscriptionEngine = require('./live-transcription-engine');
+const TranscriptionQueue = require('./transcription-queue');
 
 class NativeTranscriptionService extends EventEmitter {
   constructor(modelManager) {
@@ -21,6 +23,12 @@ class NativeTranscriptionService extends EventEmitter {
     this.binaryManager = new BinaryManager();
     this.isInitialized = false;
     this.binaryStatus = null;
+    this.liveEngine = null; // Created lazily on first live session
+
+    // NEW: Scheduling engine - bounded parallelism plus memory-aware
+    // admission so a folder drop no longer runs strictly serially
+    this.queue = new TranscriptionQueue();
+    this.queue.on('queueChanged', (state) => this.emit('queueChanged', state));
   }
 
   async initialize() {
@@ -267,17 +275,49 @@ class NativeTranscriptionService extends EventEmitter {
       throw new Error(errorMessage);
     }
 
+    // Validate file exists before taking a queue slot
+    await fs.access(filePath);
+
+    // Interactively started jobs outrank batch jobs; callers that drop many
+    // files at once pass priority: 'batch' so a single click still runs first
+    const priority = options.priority === 'batch' ? 'batch' : 'interactive';
+
+    // Add transcription to active list with better tracking
+    this.activeTranscriptions.set(transcriptionId, {
+      filePath,
+      provider,
+      priority,
+      enqueuedAt: Date.now(),
+      status: 'queued',
+      lastProgress: 0
+    });
+
     try {
-      // Validate file exists
-      await fs.access(filePath);
-      
-      // Add transcription to active list with better tracking
-      this.activeTranscriptions.set(transcriptionId, {
-        filePath,
+      // The queue decides when this job actually starts (parallelism slots
+      // plus per-model memory admission)
+      return await this.queue.enqueue({
+        id: transcriptionId,
+        model: options.model || options.modelId,
         provider,
-        startTime: Date.now(),
+        priority,
+        run: () => this.runTranscriptionJob(transcriptionId, selectedProvider, provider, filePath, options)
+      });
+    } finally {
+      // Clean up after some time
+      setTimeout(() => {
+        this.activeTranscriptions.delete(transcriptionId);
+      }, 60000); // Remove after 1 minute
+    }
+  }
+
+  // Execute one admitted transcription job. Only the queue (and the in-slot
+  // Deepgram fallback below) should call this directly.
+  async runTranscriptionJob(transcriptionId, selectedProvider, provider, filePath, options) {
+    try {
+      this.activeTranscriptions.set(transcriptionId, {
+        ...this.activeTranscriptions.get(transcriptionId),
         status: 'processing',
-        lastProgress: 0
+        startTime: Date.now()
       });
 
       // Emit start event
@@ -308,6 +348,19 @@ class NativeTranscriptionService extends EventEmitter {
         provider
       });
 
+      // NEW: Persist to the indexed history store so the transcript is
+      // full-text searchable later - a store failure must not fail the job
+      try {
+        await transcriptionStore.saveTranscription({
+          id: transcriptionId,
+          filePath,
+          provider,
+          result
+        });
+      } catch (storeError) {
+        console.warn('⚠️ Failed to save transcription to history:', storeError.message);
+      }
+
       console.log(`✅ Transcription completed successfully with ${provider}`);
       return {
         transcriptionId,
@@ -323,12 +376,13 @@ class NativeTranscriptionService extends EventEmitter {
         if (deepgramProvider.isAvailable()) {
           console.log('🔄 Attempting fallback to Deepgram provider...');
           try {
-            const fallbackResult = await this.processFile(filePath, {
+            // Reuse the queue slot this job already holds - re-enqueueing
+            // here could deadlock behind jobs waiting on this very slot
+            const fallbackResult = await this.runTranscriptionJob(transcriptionId, deepgramProvider, 'deepgram', filePath, {
               ...options,
-              provider: 'deepgram',
-              transcriptionId
+              provider: 'deepgram'
             });
-            
+
             console.log('✅ Fallback to Deepgram successful');
             return fallbackResult;
           } catch (fallbackError) {
@@ -366,12 +420,6 @@ class NativeTranscriptionService extends EventEmitter {
       }
       
       throw new Error(userFriendlyError);
-      
-    } finally {
-      // Clean up after some time
-      setTimeout(() => {
-        this.activeTranscriptions.delete(transcriptionId);
-      }, 60000); // Remove after 1 minute
     }
   }
 
@@ -408,6 +456,44 @@ class NativeTranscriptionService extends EventEmitter {
     };
   }
 
+  /**
+   * Start live microphone transcription via the whisper-stream sliding-window
+   * decoder. Partial and committed segments flow through the same event
+   * channel as file transcription progress, so the UI path is shared.
+   */
+  async startLiveTranscription(options = {}) {
+    if (!this.liveEngine) {
+      this.liveEngine = new LiveTranscriptionEngine(this.modelManager, this.binaryManager);
+
+      // Forward live events through the service's existing event surface
+      this.liveEngine.on('partial', (data) => this.emit('progress', {
+        transcriptionId: data.transcriptionId,
+        partial: true,
+        message: data.text
+      }));
+      this.liveEngine.on('segment', (data) => this.emit('segment', data));
+      this.liveEngine.on('liveStarted', (data) => this.emit('start', data));
+      this.liveEngine.on('liveStopped', (data) => this.emit('complete', {
+        transcriptionId: data.sessionId,
+        live: true
+      }));
+      this.liveEngine.on('error', (data) => this.emit('error', data));
+    }
+
+    return this.liveEngine.start(options);
+  }
+
+  async stopLiveTranscription() {
+    if (!this.liveEngine) {
+      return { success: true };
+    }
+    return this.liveEngine.stop();
+  }
+
+  getLiveTranscriptionStatus() {
+    return this.liveEngine ? this.liveEngine.getStatus() : { running: false };
+  }
+
   // Rest of the methods remain the same...
   async processRealtime(audioStream, options = {}) {
     const provider = options.provider || this.defaultProvider;
@@ -442,6 +528,17 @@ class NativeTranscriptionService extends EventEmitter {
       throw new Error(`Transcription ${transcriptionId} not found`);
     }
 
+    // NEW: Jobs still waiting in the queue are removed without touching the
+    // provider - they never started
+    if (this.queue.cancel(transcriptionId)) {
+      this.activeTranscriptions.delete(transcriptionId);
+      this.emit('cancelled', {
+        transcriptionId,
+        provider: transcription.provider
+      });
+      return;
+    }
+
     const provider = this.providers.get(transcription.provider);
     if (provider && provider._actualProvider && typeof provider._actualProvider.cancel === 'function') {
       await provider._actualProvider.cancel(transcriptionId);
@@ -475,6 +572,12 @@ class NativeTranscriptionService extends EventEmitter {
     return transcriptionStore.clearTranscriptions();
   }
 
+  // NEW: Time-coded full-text search across the stored history (FTS index,
+  // falls back to a linear scan when SQLite is unavailable)
+  async searchTranscriptions(query, limit = 50) {
+    return transcriptionStore.searchTranscriptions(query, limit);
+  }
+
   async getStats() {
     const history = await this.getTranscriptionHistory(1000);
     const providers = {};
@@ -499,11 +602,16 @@ class NativeTranscriptionService extends EventEmitter {
       totalDuration,
       providers,
       activeTranscriptions: this.activeTranscriptions.size,
+      queue: this.queue.getState(),
       availableProviders: Array.from(this.providers.keys()),
       binaryStatus: this.binaryStatus
     };
   }
 
+  getQueueState() {
+    return this.queue.getState();
+  }
+
   async cleanup() {
     // Clean up all providers
     for (const provider of this.providers.values()) {
@@ -1,4 +1,16 @@
+// src/main/services/transcription-store.js - Indexed transcript history
+// History used to live in plain serialized records, so answering "where did
+// we discuss the Q3 budget" meant loading and scanning every stored
+// transcript in JS. The store is now SQLite-backed (better-sqlite3, main
+// process only) with an FTS5 index over segment text: search returns
+// time-coded hits ranked by relevance, history listings carry metadata only
+// (segment bodies lazy-load per transcript), and startup cost stays flat no
+// matter how large the library grows. When the native module is missing the
+// store degrades to a JSON file with linear scan so history still works.
+
 const Store = require('electron-store')
+const fs = require('fs')
+const path = require('path')
 
 class TranscriptionStore {
   constructor() {
@@ -8,8 +20,14 @@ class TranscriptionStore {
         activeTranscription: null
       }
     })
+
+    this.db = null
+    this.dbFailed = false
+    this.jsonFallbackPath = null
   }
 
+  // --- Active transcription (ephemeral UI state, unchanged) ---
+
   getActiveTranscription() {
     return this.store.get('activeTranscription')
   }
@@ -31,6 +49,298 @@ class TranscriptionStore {
   clearActiveTranscription() {
     this.store.delete('activeTranscription')
   }
+
+  // --- Transcript history (SQLite + FTS5) ---
+
+  storageDir() {
+    // Lazy - the module is required before app.getPath is safe to call
+    try {
+      const { app } = require('electron')
+      return app.getPath('userData')
+    } catch (error) {
+      const os = require('os')
+      return path.join(os.homedir(), '.whisperdesk')
+    }
+  }
+
+  getDb() {
+    if (this.db || this.dbFailed) return this.db
+
+    try {
+      const Database = require('better-sqlite3')
+      const dir = this.storageDir()
+      fs.mkdirSync(dir, { recursive: true })
+      this.db = new Database(path.join(dir, 'transcripts.db'))
+      this.db.pragma('journal_mode = WAL')
+
+      this.db.exec(`
+        CREATE TABLE IF NOT EXISTS transcripts (
+          id TEXT PRIMARY KEY,
+          file_path TEXT,
+          provider TEXT,
+          created_at TEXT NOT NULL,
+          duration REAL,
+          text TEXT,
+          metadata TEXT
+        );
+        CREATE INDEX IF NOT EXISTS idx_transcripts_created
+          ON transcripts(created_at DESC);
+        CREATE TABLE IF NOT EXISTS segments (
+          transcript_id TEXT NOT NULL,
+          idx INTEGER NOT NULL,
+          start REAL,
+          end REAL,
+          speaker TEXT,
+          text TEXT,
+          PRIMARY KEY (transcript_id, idx)
+        );
+        CREATE VIRTUAL TABLE IF NOT EXISTS segments_fts USING fts5(
+          transcript_id UNINDEXED,
+          idx UNINDEXED,
+          text
+        );
+      `)
+
+      console.log('📇 Transcript history store ready (SQLite + FTS5)')
+    } catch (error) {
+      console.warn(`💡 better-sqlite3 not available (${error.message}) - transcript history falls back to a JSON scan`)
+      this.dbFailed = true
+      this.db = null
+    }
+
+    return this.db
+  }
+
+  // JSON fallback - same API, linear behavior, only used without the module
+  readJsonHistory() {
+    if (!this.jsonFallbackPath) {
+      this.jsonFallbackPath = path.join(this.storageDir(), 'transcription-history.json')
+    }
+    try {
+      return JSON.parse(fs.readFileSync(this.jsonFallbackPath, 'utf8'))
+    } catch (error) {
+      return []
+    }
+  }
+
+  writeJsonHistory(records) {
+    fs.mkdirSync(path.dirname(this.jsonFallbackPath), { recursive: true })
+    fs.writeFileSync(this.jsonFallbackPath, JSON.stringify(records))
+  }
+
+  async saveTranscription({ id, filePath, provider, result }) {
+    const createdAt = new Date().toISOString()
+    const segments = Array.isArray(result?.segments) ? result.segments : []
+    const metadata = result?.metadata || {}
+
+    const db = this.getDb()
+    if (!db) {
+      const records = this.readJsonHistory().filter(record => record.id !== id)
+      records.push({ id, filePath, provider, createdAt, result })
+      this.writeJsonHistory(records)
+      return { id }
+    }
+
+    const insertAll = db.transaction(() => {
+      db.prepare(`
+        INSERT OR REPLACE INTO transcripts (id, file_path, provider, created_at, duration, text, metadata)
+        VALUES (?, ?, ?, ?, ?, ?, ?)
+      `).run(
+        id,
+        filePath || null,
+        provider || null,
+        createdAt,
+        metadata.duration || null,
+        result?.text || '',
+        JSON.stringify(metadata)
+      )
+
+      db.prepare('DELETE FROM segments WHERE transcript_id = ?').run(id)
+      db.prepare('DELETE FROM segments_fts WHERE transcript_id = ?').run(id)
+
+      const insertSegment = db.prepare(`
+        INSERT INTO segments (transcript_id, idx, start, end, speaker, text)
+        VALUES (?, ?, ?, ?, ?, ?)
+      `)
+      const insertFts = db.prepare(`
+        INSERT INTO segments_fts (transcript_id, idx, text)
+        VALUES (?, ?, ?)
+      `)
+
+      segments.forEach((segment, index) => {
+        const text = segment.text || ''
+        insertSegment.run(
+          id,
+          index,
+          Number(segment.start) || 0,
+          Number(segment.end) || 0,
+          segment.speakerLabel || segment.speakerId || null,
+          text
+        )
+        insertFts.run(id, index, text)
+      })
+    })
+
+    insertAll()
+    return { id }
+  }
+
+  // Metadata only - segment bodies lazy-load through getTranscription(), so
+  // listing months of history never deserializes the transcripts themselves
+  async getTranscriptions(limit = 50) {
+    const db = this.getDb()
+    if (!db) {
+      return this.readJsonHistory()
+        .sort((a, b) => (b.createdAt || '').localeCompare(a.createdAt || ''))
+        .slice(0, limit)
+        .map(record => ({
+          id: record.id,
+          filePath: record.filePath,
+          provider: record.provider,
+          createdAt: record.createdAt,
+          metadata: record.result?.metadata || {}
+        }))
+    }
+
+    return db.prepare(`
+      SELECT id, file_path, provider, created_at, duration, metadata
+      FROM transcripts ORDER BY created_at DESC LIMIT ?
+    `).all(limit).map(row => ({
+      id: row.id,
+      filePath: row.file_path,
+      provider: row.provider,
+      createdAt: row.created_at,
+      metadata: this.parseMetadata(row.metadata, row.duration)
+    }))
+  }
+
+  async getTranscription(transcriptionId) {
+    const db = this.getDb()
+    if (!db) {
+      const record = this.readJsonHistory().find(entry => entry.id === transcriptionId)
+      return record ? { id: record.id, filePath: record.filePath, provider: record.provider, createdAt: record.createdAt, ...record.result } : null
+    }
+
+    const row = db.prepare('SELECT * FROM transcripts WHERE id = ?').get(transcriptionId)
+    if (!row) return null
+
+    const segments = db.prepare(`
+      SELECT idx, start, end, speaker, text FROM segments
+      WHERE transcript_id = ? ORDER BY idx
+    `).all(transcriptionId).map(segment => ({
+      id: segment.idx,
+      start: segment.start,
+      end: segment.end,
+      ...(segment.speaker && { speakerLabel: segment.speaker }),
+      text: segment.text
+    }))
+
+    return {
+      id: row.id,
+      filePath: row.file_path,
+      provider: row.provider,
+      createdAt: row.created_at,
+      text: row.text,
+      segments,
+      metadata: this.parseMetadata(row.metadata, row.duration)
+    }
+  }
+
+  async deleteTranscription(transcriptionId) {
+    const db = this.getDb()
+    if (!db) {
+      this.writeJsonHistory(this.readJsonHistory().filter(record => record.id !== transcriptionId))
+      return true
+    }
+
+    const remove = db.transaction(() => {
+      db.prepare('DELETE FROM segments WHERE transcript_id = ?').run(transcriptionId)
+      db.prepare('DELETE FROM segments_fts WHERE transcript_id = ?').run(transcriptionId)
+      db.prepare('DELETE FROM transcripts WHERE id = ?').run(transcriptionId)
+    })
+    remove()
+    return true
+  }
+
+  async clearTranscriptions() {
+    const db = this.getDb()
+    if (!db) {
+      this.writeJsonHistory([])
+      return true
+    }
+
+    const clear = db.transaction(() => {
+      db.exec('DELETE FROM segments; DELETE FROM segments_fts; DELETE FROM transcripts;')
+    })
+    clear()
+    return true
+  }
+
+  /**
+   * Full-text search across every stored transcript. Returns time-coded hits
+   * ranked by relevance: { transcriptionId, filePath, createdAt, start, end,
+   * speaker, snippet }. The user query is tokenized into quoted FTS terms so
+   * punctuation can never become an FTS syntax error.
+   */
+  async searchTranscriptions(query, limit = 50) {
+    const terms = String(query || '')
+      .split(/\s+/)
+      .filter(Boolean)
+      .map(term => `"${term.replace(/"/g, '')}"`)
+      .join(' ')
+    if (!terms) return []
+
+    const db = this.getDb()
+    if (!db) {
+      const needle = String(query).toLowerCase()
+      const hits = []
+      for (const record of this.readJsonHistory()) {
+        for (const segment of record.result?.segments || []) {
+          if ((segment.text || '').toLowerCase().includes(needle)) {
+            hits.push({
+              transcriptionId: record.id,
+              filePath: record.filePath,
+              createdAt: record.createdAt,
+              start: segment.start,
+              end: segment.end,
+              speaker: segment.speakerLabel || null,
+              snippet: segment.text
+            })
+            if (hits.length >= limit) return hits
+          }
+        }
+      }
+      return hits
+    }
+
+    return db.prepare(`
+      SELECT f.transcript_id, f.idx,
+             snippet(segments_fts, 2, '[', ']', '…', 12) AS snippet,
+             s.start, s.end, s.speaker,
+             t.file_path, t.created_at
+      FROM segments_fts f
+      JOIN segments s ON s.transcript_id = f.transcript_id AND s.idx = f.idx
+      JOIN transcripts t ON t.id = f.transcript_id
+      WHERE segments_fts MATCH ?
+      ORDER BY rank LIMIT ?
+    `).all(terms, limit).map(row => ({
+      transcriptionId: row.transcript_id,
+      filePath: row.file_path,
+      createdAt: row.created_at,
+      start: row.start,
+      end: row.end,
+      speaker: row.speaker,
+      snippet: row.snippet
+    }))
+  }
+
+  parseMetadata(json, duration) {
+    try {
+      return { duration, ...JSON.parse(json || '{}') }
+    } catch (error) {
+      return { duration }
+    }
+  }
 }
 
-module.exports = new TranscriptionStore() 
\ No newline at end of file
+module.exports = new TranscriptionStore()
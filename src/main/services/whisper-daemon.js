@@ -0,0 +1,298 @@
+// src/main/services/whisper-daemon.js - Persistent whisper-server daemon management
+// Keeps a whisper_context resident between jobs so repeat transcriptions skip model load
+
+const { EventEmitter } = require('events');
+const { spawn } = require('child_process');
+const path = require('path');
+const http = require('http');
+const os = require('os');
+const FormData = require('form-data');
+const modelResidency = require('./model-residency');
+
+const DAEMON_HOST = '127.0.0.1';
+const DAEMON_BASE_PORT = 8178;
+const STARTUP_TIMEOUT = 120000;   // Large models can take a while to load
+const IDLE_SHUTDOWN_MS = 10 * 60 * 1000; // Shut the daemon down after 10 min of no jobs
+const INFERENCE_TIMEOUT = 30 * 60 * 1000;
+
+/**
+ * Manages a long-lived whisper-server process (built alongside whisper-cli).
+ * The first job on a model pays the load cost; subsequent jobs on the same
+ * model start decoding immediately. Switching models restarts the daemon.
+ */
+class WhisperDaemon extends EventEmitter {
+  constructor(binaryManager) {
+    super();
+    this.binaryManager = binaryManager;
+    this.platform = os.platform();
+    this.process = null;
+    this.port = null;
+    this.currentModelPath = null;
+    this.starting = null; // Promise while a daemon is booting
+    this.idleTimer = null;
+    this.jobCounter = 0;
+  }
+
+  getServerBinaryPath() {
+    const executableName = this.platform === 'win32' ? 'whisper-server.exe' : 'whisper-server';
+    return path.join(this.binaryManager.binariesDir, executableName);
+  }
+
+  async isServerBinaryAvailable() {
+    try {
+      const fs = require('fs').promises;
+      await fs.access(this.getServerBinaryPath());
+      return true;
+    } catch (error) {
+      return false;
+    }
+  }
+
+  isRunning() {
+    return this.process !== null && this.process.exitCode === null;
+  }
+
+  /**
+   * Ensure a daemon is running and loaded with the given model.
+   * Restarts the daemon when a different model is requested.
+   */
+  async ensureStarted(modelPath, options = {}) {
+    if (this.starting) {
+      await this.starting;
+    }
+
+    if (this.isRunning() && this.currentModelPath === modelPath) {
+      return this.port;
+    }
+
+    if (this.isRunning()) {
+      console.log(`🔄 Whisper daemon model change: ${path.basename(this.currentModelPath)} -> ${path.basename(modelPath)}`);
+      await this.stop();
+    }
+
+    this.starting = this.startDaemon(modelPath, options);
+    try {
+      await this.starting;
+    } finally {
+      this.starting = null;
+    }
+
+    return this.port;
+  }
+
+  async startDaemon(modelPath, options = {}) {
+    const serverPath = this.getServerBinaryPath();
+    const port = DAEMON_BASE_PORT + (process.pid % 100);
+
+    const args = [
+      '--model', modelPath,
+      '--host', DAEMON_HOST,
+      '--port', port.toString(),
+      '--threads', (options.threads || Math.min(4, os.cpus().length)).toString()
+    ];
+
+    console.log(`🚀 Starting whisper daemon: ${serverPath}`);
+    console.log(`📋 Daemon args: ${args.join(' ')}`);
+
+    const spawnOptions = {
+      stdio: ['ignore', 'pipe', 'pipe'],
+      env: { ...process.env }
+    };
+
+    if (this.platform === 'win32') {
+      spawnOptions.cwd = path.dirname(serverPath);
+    }
+
+    const daemonProcess = spawn(serverPath, args, spawnOptions);
+    this.process = daemonProcess;
+    this.port = port;
+    this.currentModelPath = modelPath;
+
+    daemonProcess.stdout.on('data', (data) => {
+      console.log(`📝 whisper-server: ${data.toString().trim()}`);
+    });
+
+    daemonProcess.stderr.on('data', (data) => {
+      console.log(`📝 whisper-server: ${data.toString().trim()}`);
+    });
+
+    daemonProcess.on('close', (code) => {
+      if (this.process === daemonProcess) {
+        console.log(`🏁 Whisper daemon exited with code: ${code}`);
+        if (this.currentModelPath) {
+          modelResidency.release(this.currentModelPath, 'daemon');
+        }
+        this.process = null;
+        this.port = null;
+        this.currentModelPath = null;
+        this.clearIdleTimer();
+        this.emit('stopped', { code });
+      }
+    });
+
+    daemonProcess.on('error', (error) => {
+      console.error(`❌ Whisper daemon failed to start: ${error.message}`);
+    });
+
+    // Wait for the HTTP endpoint to come up (model load happens during startup)
+    await this.waitForReady(port);
+    console.log(`✅ Whisper daemon ready on port ${port} with ${path.basename(modelPath)}`);
+    modelResidency.acquire(modelPath, 'daemon');
+    this.emit('started', { port, modelPath });
+    this.resetIdleTimer();
+  }
+
+  async waitForReady(port) {
+    const deadline = Date.now() + STARTUP_TIMEOUT;
+
+    while (Date.now() < deadline) {
+      if (!this.isRunning()) {
+        throw new Error('Whisper daemon process exited during startup');
+      }
+
+      const ready = await new Promise((resolve) => {
+        const req = http.request({
+          host: DAEMON_HOST,
+          port,
+          path: '/',
+          method: 'GET',
+          timeout: 2000
+        }, (res) => {
+          res.resume();
+          resolve(true);
+        });
+        req.on('error', () => resolve(false));
+        req.on('timeout', () => { req.destroy(); resolve(false); });
+        req.end();
+      });
+
+      if (ready) return;
+      await new Promise(resolve => setTimeout(resolve, 500));
+    }
+
+    await this.stop();
+    throw new Error('Whisper daemon did not become ready in time');
+  }
+
+  /**
+   * Run a transcription job against the resident context.
+   * Returns the parsed verbose JSON response from whisper-server.
+   */
+  async transcribe(audioPath, options = {}) {
+    const port = await this.ensureStarted(options.modelPath, options);
+    this.jobCounter++;
+    this.clearIdleTimer();
+
+    console.log(`🎵 Whisper daemon job #${this.jobCounter}: ${path.basename(audioPath)}`);
+
+    try {
+      const form = new FormData();
+      form.append('file', require('fs').createReadStream(audioPath));
+      form.append('response_format', 'verbose_json');
+
+      if (options.language && options.language !== 'auto') {
+        form.append('language', options.language);
+      }
+      if (options.task === 'translate') {
+        form.append('translate', 'true');
+      }
+      if (options.temperature > 0) {
+        form.append('temperature', options.temperature.toString());
+      }
+
+      const response = await new Promise((resolve, reject) => {
+        const req = http.request({
+          host: DAEMON_HOST,
+          port,
+          path: '/inference',
+          method: 'POST',
+          headers: form.getHeaders(),
+          timeout: INFERENCE_TIMEOUT
+        }, (res) => {
+          let body = '';
+          res.on('data', (chunk) => { body += chunk; });
+          res.on('end', () => {
+            if (res.statusCode === 200) {
+              resolve(body);
+            } else {
+              reject(new Error(`Whisper daemon returned HTTP ${res.statusCode}: ${body.substring(0, 200)}`));
+            }
+          });
+        });
+
+        req.on('error', reject);
+        req.on('timeout', () => {
+          req.destroy();
+          reject(new Error('Whisper daemon inference timeout'));
+        });
+
+        form.pipe(req);
+      });
+
+      return JSON.parse(response);
+    } finally {
+      this.resetIdleTimer();
+    }
+  }
+
+  resetIdleTimer() {
+    this.clearIdleTimer();
+    this.idleTimer = setTimeout(() => {
+      console.log('💤 Whisper daemon idle, shutting down to free model memory');
+      this.stop().catch(() => {});
+    }, IDLE_SHUTDOWN_MS);
+    if (this.idleTimer.unref) this.idleTimer.unref();
+  }
+
+  clearIdleTimer() {
+    if (this.idleTimer) {
+      clearTimeout(this.idleTimer);
+      this.idleTimer = null;
+    }
+  }
+
+  async stop() {
+    this.clearIdleTimer();
+
+    if (!this.isRunning()) {
+      this.process = null;
+      return;
+    }
+
+    const daemonProcess = this.process;
+    if (this.currentModelPath) {
+      modelResidency.release(this.currentModelPath, 'daemon');
+    }
+    this.process = null;
+    this.port = null;
+    this.currentModelPath = null;
+
+    await new Promise((resolve) => {
+      const forceKill = setTimeout(() => {
+        daemonProcess.kill('SIGKILL');
+        resolve();
+      }, 5000);
+
+      daemonProcess.once('close', () => {
+        clearTimeout(forceKill);
+        resolve();
+      });
+
+      daemonProcess.kill('SIGTERM');
+    });
+
+    console.log('🛑 Whisper daemon stopped');
+  }
+
+  getStatus() {
+    return {
+      running: this.isRunning(),
+      port: this.port,
+      modelPath: this.currentModelPath,
+      jobsServed: this.jobCounter,
+      serverBinaryPath: this.getServerBinaryPath()
+    };
+  }
+}
+
+module.exports = WhisperDaemon;
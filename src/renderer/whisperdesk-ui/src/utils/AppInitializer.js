@@ -7,6 +7,10 @@ class AppInitializer {
     this.initializing = false;
     this.services = {};
     this.eventCleanups = {};
+
+    // NEW: Accumulator for large transcripts streamed as segmentBatch
+    // messages ahead of a slim complete event
+    this.streamedSegments = null;
     
     // 🔴 FIXED: Centralized state with proper structure
     this.centralState = {
@@ -573,12 +577,42 @@ class AppInitializer {
       });
     }
 
+    if (api.onSegmentBatch) {
+      this.eventCleanups.transcriptionSegmentBatch = api.onSegmentBatch((data) => {
+        // NEW: Large transcripts stream in as bounded batches - accumulate
+        // them and render progressively instead of waiting for one giant
+        // complete payload
+        if (data.batchIndex === 0 || this.streamedSegments?.transcriptionId !== data.transcriptionId) {
+          this.streamedSegments = { transcriptionId: data.transcriptionId, segments: [] };
+        }
+        this.streamedSegments.segments.push(...(data.segments || []));
+
+        if (this.appStateCallback) {
+          this.appStateCallback({
+            lastTranscriptionResult: {
+              text: '',
+              segments: [...this.streamedSegments.segments],
+              metadata: { partial: true, segmentCount: this.streamedSegments.segments.length }
+            },
+            progressMessage: `Rendering transcript... (${data.batchIndex + 1}/${data.totalBatches})`
+          });
+        }
+      });
+    }
+
     if (api.onComplete) {
       this.eventCleanups.transcriptionComplete = api.onComplete((data) => {
         if (data.result && this.appStateCallback) {
+          // NEW: Reattach the segments that arrived as segmentBatch messages
+          let result = data.result;
+          if (result.segmentsStreamed && this.streamedSegments?.transcriptionId === data.transcriptionId) {
+            result = { ...result, segments: this.streamedSegments.segments };
+          }
+          this.streamedSegments = null;
+
           this.appStateCallback({
-            transcription: data.result.text || '',
-            lastTranscriptionResult: data.result,
+            transcription: result.text || '',
+            lastTranscriptionResult: result,
             isTranscribing: false,
             progress: 100,
             progressMessage: 'Complete!'
@@ -102,6 +102,13 @@ if [[ "$OSTYPE" == "darwin"* ]]; then
         # CMAKE_ARGS+=("-DGGML_NATIVE=OFF")
     fi
     CMAKE_ARGS+=("-DCMAKE_OSX_DEPLOYMENT_TARGET=11.0") # macOS specific
+
+    # Metal GPU backend - whisper-cli picks the GPU at runtime and falls back
+    # to CPU automatically (or via --no-gpu). Embedding the shader library
+    # keeps the binary self-contained for electron-builder packaging.
+    print_status "Enabling Metal GPU backend with embedded shader library..."
+    CMAKE_ARGS+=("-DGGML_METAL=ON")
+    CMAKE_ARGS+=("-DGGML_METAL_EMBED_LIBRARY=ON")
 elif [[ "$OSTYPE" == "linux-gnu"* ]]; then
     print_status "Configuring for Linux (forcing generic x86_64 build to avoid arch detection issues)..."
     CMAKE_ARGS+=("-DCMAKE_SYSTEM_PROCESSOR=x86_64")
@@ -112,6 +119,15 @@ else
     # No platform-specific args added here, relies on CMake defaults + base args
 fi
 
+# SDL2 is only needed for the whisper-stream live-captioning binary; build it
+# when the dev package is present, otherwise skip it without failing the build
+if pkg-config --exists sdl2 2>/dev/null || { [[ "$OSTYPE" == "darwin"* ]] && brew --prefix sdl2 >/dev/null 2>&1; }; then
+    print_status "SDL2 found - enabling whisper-stream (live transcription)"
+    CMAKE_ARGS+=("-DWHISPER_SDL2=ON")
+else
+    print_warning "SDL2 not found - whisper-stream (live transcription) will not be built"
+fi
+
 print_status "Final CMake arguments: ${CMAKE_ARGS[@]}"
 cmake "${CMAKE_ARGS[@]}"
 
@@ -166,6 +182,65 @@ fi
 
 print_success "Found whisper binary at: $WHISPER_BINARY"
 
+# Locate the whisper-server daemon binary (built by the same examples target).
+# It is optional: the app falls back to per-job whisper-cli spawns without it.
+WHISPER_SERVER_BINARY=""
+if [ -f "build/bin/whisper-server" ]; then
+    WHISPER_SERVER_BINARY="build/bin/whisper-server"
+elif [ -f "bin/whisper-server" ]; then
+    WHISPER_SERVER_BINARY="bin/whisper-server"
+fi
+
+if [ -n "$WHISPER_SERVER_BINARY" ]; then
+    print_success "Found whisper-server daemon binary at: $WHISPER_SERVER_BINARY"
+else
+    print_warning "whisper-server not found - persistent daemon mode will be unavailable"
+fi
+
+# Locate the whisper-stream binary (only built when SDL2 was available)
+WHISPER_STREAM_BINARY=""
+if [ -f "build/bin/whisper-stream" ]; then
+    WHISPER_STREAM_BINARY="build/bin/whisper-stream"
+elif [ -f "bin/whisper-stream" ]; then
+    WHISPER_STREAM_BINARY="bin/whisper-stream"
+fi
+
+if [ -n "$WHISPER_STREAM_BINARY" ]; then
+    print_success "Found whisper-stream binary at: $WHISPER_STREAM_BINARY"
+else
+    print_warning "whisper-stream not found - live transcription will be unavailable"
+fi
+
+# Locate the bench tool (powers the in-app hardware benchmark / model advisor)
+WHISPER_BENCH_BINARY=""
+if [ -f "build/bin/whisper-bench" ]; then
+    WHISPER_BENCH_BINARY="build/bin/whisper-bench"
+elif [ -f "build/bin/bench" ]; then
+    WHISPER_BENCH_BINARY="build/bin/bench"
+elif [ -f "bin/whisper-bench" ]; then
+    WHISPER_BENCH_BINARY="bin/whisper-bench"
+fi
+
+if [ -n "$WHISPER_BENCH_BINARY" ]; then
+    print_success "Found bench tool at: $WHISPER_BENCH_BINARY"
+else
+    print_warning "whisper-bench not found - in-app benchmarking will be unavailable"
+fi
+
+# Locate the quantize tool (lets the app convert installed models to q5_0/q8_0)
+QUANTIZE_BINARY=""
+if [ -f "build/bin/quantize" ]; then
+    QUANTIZE_BINARY="build/bin/quantize"
+elif [ -f "bin/quantize" ]; then
+    QUANTIZE_BINARY="bin/quantize"
+fi
+
+if [ -n "$QUANTIZE_BINARY" ]; then
+    print_success "Found quantize tool at: $QUANTIZE_BINARY"
+else
+    print_warning "quantize not found - in-app model quantization will be unavailable"
+fi
+
 # Test the binary
 print_status "Testing whisper binary..."
 if "$WHISPER_BINARY" --help >/dev/null 2>&1; then
@@ -181,9 +256,38 @@ if [[ "$OSTYPE" == "darwin"* ]] || [[ "$OSTYPE" == "linux-gnu"* ]]; then
     cp "$WHISPER_BINARY" "$BINARIES_DIR/whisper-cli"
     chmod +x "$BINARIES_DIR/whisper-cli"
     FINAL_BINARY="$BINARIES_DIR/whisper-cli"
+
+    if [ -n "$WHISPER_SERVER_BINARY" ]; then
+        cp "$WHISPER_SERVER_BINARY" "$BINARIES_DIR/whisper-server"
+        chmod +x "$BINARIES_DIR/whisper-server"
+        print_success "Daemon binary copied to: $BINARIES_DIR/whisper-server"
+    fi
+
+    if [ -n "$WHISPER_STREAM_BINARY" ]; then
+        cp "$WHISPER_STREAM_BINARY" "$BINARIES_DIR/whisper-stream"
+        chmod +x "$BINARIES_DIR/whisper-stream"
+        print_success "Stream binary copied to: $BINARIES_DIR/whisper-stream"
+    fi
+
+    if [ -n "$QUANTIZE_BINARY" ]; then
+        cp "$QUANTIZE_BINARY" "$BINARIES_DIR/quantize"
+        chmod +x "$BINARIES_DIR/quantize"
+        print_success "Quantize tool copied to: $BINARIES_DIR/quantize"
+    fi
+
+    if [ -n "$WHISPER_BENCH_BINARY" ]; then
+        cp "$WHISPER_BENCH_BINARY" "$BINARIES_DIR/whisper-bench"
+        chmod +x "$BINARIES_DIR/whisper-bench"
+        print_success "Bench tool copied to: $BINARIES_DIR/whisper-bench"
+    fi
 else
     cp "$WHISPER_BINARY" "$BINARIES_DIR/whisper-cli.exe"
     FINAL_BINARY="$BINARIES_DIR/whisper-cli.exe"
+
+    if [ -n "$WHISPER_SERVER_BINARY" ]; then
+        cp "$WHISPER_SERVER_BINARY" "$BINARIES_DIR/whisper-server.exe"
+        print_success "Daemon binary copied to: $BINARIES_DIR/whisper-server.exe"
+    fi
 fi
 
 # Verify the copied binary
@@ -4,7 +4,8 @@
 param (
     [string]$Architecture = "x64",
     [string]$BuildType = "Release",
-    [string]$SDL2Version = "2.28.5"
+    [string]$SDL2Version = "2.28.5",
+    [string]$GpuBackend = "none"        # none | cuda | vulkan - builds an optional GPU backend DLL
 )
 
 $ErrorActionPreference = "Stop"
@@ -32,6 +33,7 @@ Write-Info "Using official whisper.cpp build method with whisper-cli.exe"
 Write-Info "Architecture: $Architecture"
 Write-Info "Build Type: $BuildType"
 Write-Info "SDL2 Version: $SDL2Version"
+Write-Info "GPU Backend: $GpuBackend"
 
 # Set up directories
 $ScriptDir = Split-Path -Parent $MyInvocation.MyCommand.Path
@@ -96,7 +98,28 @@ try {
         "-DWHISPER_BUILD_SERVER=ON",        # Build whisper-server.exe
         "-DWHISPER_BUILD_BENCHMARKS=ON"     # Build benchmark tools
     )
-    
+
+    # Optional GPU backend - ggml loads backend DLLs at runtime, so these ship
+    # alongside ggml-cpu.dll and machines without the driver just fall back to CPU
+    switch ($GpuBackend.ToLower()) {
+        "cuda" {
+            $cmakeArgs += "-DGGML_CUDA=ON"
+            $cmakeArgs += "-DGGML_BACKEND_DL=ON"
+            Write-Info "CUDA backend enabled (requires CUDA Toolkit installed)"
+        }
+        "vulkan" {
+            $cmakeArgs += "-DGGML_VULKAN=ON"
+            $cmakeArgs += "-DGGML_BACKEND_DL=ON"
+            Write-Info "Vulkan backend enabled (requires Vulkan SDK installed)"
+        }
+        "none" {
+            Write-Info "CPU-only build (pass -GpuBackend cuda or vulkan to build a GPU backend DLL)"
+        }
+        default {
+            throw "Unknown GPU backend: $GpuBackend (expected none, cuda or vulkan)"
+        }
+    }
+
     Write-Info "CMake arguments: $($cmakeArgs -join ' ')"
     & cmake @cmakeArgs
     
@@ -129,12 +152,14 @@ try {
         "whisper-cli.exe"           # ← UPDATED: Using whisper-cli.exe instead of main.exe
     )
     
-    # Optional executables that might be built
+    # Optional executables and GPU backend DLLs that might be built
     $OptionalFiles = @(
         "whisper-stream.exe",
         "whisper-server.exe",
         "whisper-bench.exe",
-        "quantize.exe"
+        "quantize.exe",
+        "ggml-cuda.dll",
+        "ggml-vulkan.dll"
     )
     
     foreach ($file in $RequiredFiles) {